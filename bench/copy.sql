@@ -0,0 +1,77 @@
+-- fen parsing and rendering benchmark, in rows per second: COPY FROM of :rows
+-- fens into a text table (the cost of COPY itself) and into a board table (the
+-- same plus board_in), the fen::board cast and boards_from_text over the loaded
+-- text, then COPY TO of the boards against export_fen.
+-- Run it against the old and new builds to compare board_in and board_out.
+--
+-- Not run against a server yet, so there are no COPY numbers here. What has
+-- been measured is board_in alone, built at -O2 outside the server (malloc
+-- standing in for palloc), calling it 1000000 times over the 1706 fens of
+-- positions.sql and taking the median of 11 runs on one shared core:
+--
+--                                      board_in calls per second
+--   two pass parser (before)                  1990000
+--   _board_parse_fen (after)                  2420000   (x1.2, x1.1-1.3 over the runs)
+--
+-- Allocating and zeroing the result is a good part of both. COPY into a board
+-- table also pays for COPY itself (the 'copy text' row), so its rows per
+-- second gains less than board_in does.
+--
+-- The file is written and read by the server, so this needs superuser or
+-- pg_write_server_files and pg_read_server_files.
+--
+-- usage: psql -X -f bench/copy.sql [-v file=/path/on/server]
+
+\if :{?file}
+\else
+\set file /tmp/chess_index_bench_copy.fen
+\endif
+\set rows 1000000
+set client_min_messages = warning;
+set max_parallel_workers_per_gather = 0;
+
+\ir positions.sql
+
+select format('copy (select fen::text from bench_position) to %L', :'file') \gexec
+
+create temp table bench_copy_text(fen text);
+create temp table bench_copy_board(fen board);
+create temp table bench_copy_result(name text, rows int8, seconds float8);
+
+create or replace function pg_temp.bench_copy(name text, query text)
+returns void language plpgsql as $$
+declare
+    t timestamptz := clock_timestamp();
+    n int8;
+begin
+    execute query;
+    get diagnostics n = row_count;
+    insert into bench_copy_result values (name, n, extract(epoch from clock_timestamp() - t));
+end
+$$;
+
+select pg_temp.bench_copy('copy text', format('copy bench_copy_text from %L', :'file'));
+select pg_temp.bench_copy('copy board', format('copy bench_copy_board from %L', :'file'));
+select pg_temp.bench_copy('fen::board', 'create temp table bench_copy_cast as select fen::board from bench_copy_text');
+
+select exists(select from pg_proc where proname = 'boards_from_text') as has_boards_from_text \gset
+\if :has_boards_from_text
+-- 1000 fens per call
+select pg_temp.bench_copy('boards_from_text', $q$
+    create temp table bench_copy_batch as
+    select unnest(boards_from_text(array_agg(fen)))
+    from (select fen, row_number() over () / 1000 as batch from bench_copy_text) t
+    group by batch
+$q$);
+\endif
+
+select pg_temp.bench_copy('copy to', format('copy bench_copy_board to %L', :'file'));
+select exists(select from pg_proc where proname = 'export_fen') as has_export_fen \gset
+\if :has_export_fen
+select pg_temp.bench_copy('export_fen', format('select export_fen(%L, %L)', 'select fen from bench_copy_board', :'file'));
+update bench_copy_result set rows = (select count(*) from bench_copy_board) where name = 'export_fen';
+\endif
+
+select name, rows, round(seconds::numeric, 3) as seconds,
+       round(rows / greatest(seconds, 1e-6)) as rows_per_second
+from bench_copy_result;
@@ -0,0 +1,18 @@
+-- hash_board_ops benchmark: GROUP BY board hashes with zobrist(board);
+-- GROUP BY fen::text is the old path of rendering the fen and hashing the text.
+--
+-- usage: psql -X -f bench/hash.sql
+
+\set rows 1000000
+\timing on
+set client_min_messages = warning;
+set enable_sort = off;
+set max_parallel_workers_per_gather = 0;
+
+\ir positions.sql
+
+\echo 'zobrist'
+explain (analyze, timing off) select fen, count(*) from bench_position group by fen;
+
+\echo 'fen text'
+explain (analyze, timing off) select fen::text, count(*) from bench_position group by fen::text;
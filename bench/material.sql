@@ -0,0 +1,21 @@
+-- material benchmark: endgame classification with material(board) = 'KRPkr'
+-- against the older pieces(board, side) pindex pair.
+--
+-- usage: psql -X -f bench/material.sql
+
+\set rows 1000000
+\timing on
+set client_min_messages = warning;
+set max_parallel_workers_per_gather = 0;
+
+\ir positions.sql
+
+\echo 'material'
+explain (analyze, timing off) select count(*) from bench_position where material(fen) = 'KQRRBBNNPPPPPPPPkqrrbbnnpppppppp';
+
+\echo 'pieces'
+explain (analyze, timing off) select count(*) from bench_position
+    where pieces(fen, 'w') = 'QRRBBNNPPPPPPPP' and pieces(fen, 'b') = 'QRRBBNNPPPPPPPP';
+
+\echo 'group by material'
+explain (analyze, timing off) select material(fen), count(*) from bench_position group by 1;
@@ -0,0 +1,48 @@
+-- move generation benchmark: perft on the standard positions, checked
+-- against the known node counts, in leaf nodes per second.
+--
+-- usage: psql -X -f bench/perft.sql [-v depth=N]
+--
+-- depth=N lowers the deeper positions to N plies; those can only report speed.
+
+\if :{?depth}
+\else
+\set depth 6
+\endif
+set client_min_messages = warning;
+
+create temp table bench_perft(name text, fen board, depth int, nodes int8);
+insert into bench_perft values
+     ('initial',   'rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -', 5, 4865609)
+    ,('kiwipete',  'r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -', 4, 4085603)
+    ,('position3', '8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - -', 6, 11030083)
+    ,('position4', 'r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq -', 4, 422333)
+    ,('position5', 'rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ -', 4, 2103487)
+    ,('position6', 'r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - -', 4, 3894594)
+;
+update bench_perft set depth = :depth, nodes = null where depth > :depth;
+
+create or replace function pg_temp.bench_perft(b board, d int, out nodes int8, out seconds float8)
+language plpgsql as $$
+declare
+    t timestamptz := clock_timestamp();
+begin
+    nodes := perft(b, d);
+    seconds := extract(epoch from clock_timestamp() - t);
+end
+$$;
+
+create temp table bench_perft_result as
+select p.name, p.depth, r.nodes, p.nodes as expected, r.seconds
+from bench_perft p, pg_temp.bench_perft(p.fen, p.depth) r;
+
+select name, depth, nodes,
+       case when expected is null then '?' when nodes = expected then 'ok' else 'FAIL' end as check,
+       round(seconds::numeric, 3) as seconds,
+       round(nodes / greatest(seconds, 1e-6)) as nodes_per_second
+from bench_perft_result
+order by name;
+
+select sum(nodes) as nodes, round(sum(seconds)::numeric, 3) as seconds,
+       round(sum(nodes) / greatest(sum(seconds), 1e-6)) as nodes_per_second
+from bench_perft_result;
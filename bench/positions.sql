@@ -0,0 +1,1717 @@
+-- fills bench_position with :rows boards built from the games in test/sql/setup.sql
+-- included by the other bench scripts
+
+create temp table bench_fen(fen text);
+\copy bench_fen from stdin
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppp1ppp/4p3/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppp1ppp/4p3/8/3PP3/8/PPP2PPP/RNBQKBNR b KQkq d3
+rnbqkbnr/p1pp1ppp/1p2p3/8/3PP3/8/PPP2PPP/RNBQKBNR w KQkq -
+rnbqkbnr/p1pp1ppp/1p2p3/8/3PP3/P7/1PP2PPP/RNBQKBNR b KQkq -
+rn1qkbnr/pbpp1ppp/1p2p3/8/3PP3/P7/1PP2PPP/RNBQKBNR w KQkq -
+rn1qkbnr/pbpp1ppp/1p2p3/8/3PP3/P1N5/1PP2PPP/R1BQKBNR b KQkq -
+rn1qkb1r/pbpp1ppp/1p2p2n/8/3PP3/P1N5/1PP2PPP/R1BQKBNR w KQkq -
+rn1qkb1r/pbpp1ppp/1p2p2B/8/3PP3/P1N5/1PP2PPP/R2QKBNR b KQkq -
+rn1qkb1r/pbpp1p1p/1p2p2p/8/3PP3/P1N5/1PP2PPP/R2QKBNR w KQkq -
+rn1qkb1r/pbpp1p1p/1p2p2p/8/3PP3/P1N5/1PP1BPPP/R2QK1NR b KQkq -
+rn2kb1r/pbpp1p1p/1p2p2p/6q1/3PP3/P1N5/1PP1BPPP/R2QK1NR w KQkq -
+rn2kb1r/pbpp1p1p/1p2p2p/6q1/3PP1B1/P1N5/1PP2PPP/R2QK1NR b KQkq -
+rn2kb1r/pbpp1p1p/1p2p3/6qp/3PP1B1/P1N5/1PP2PPP/R2QK1NR w KQkq -
+rn2kb1r/pbpp1p1p/1p2p3/6qp/3PP1B1/P1N2N2/1PP2PPP/R2QK2R b KQkq -
+rn2kb1r/pbpp1p1p/1p2p1q1/7p/3PP1B1/P1N2N2/1PP2PPP/R2QK2R w KQkq -
+rn2kb1r/pbpp1p1p/1p2p1q1/7p/3PP1BN/P1N5/1PP2PPP/R2QK2R b KQkq -
+rn2kb1r/pbpp1p1p/1p2p3/6qp/3PP1BN/P1N5/1PP2PPP/R2QK2R w KQkq -
+rn2kb1r/pbpp1p1p/1p2p3/6qB/3PP2N/P1N5/1PP2PPP/R2QK2R b KQkq -
+rn2kb1r/pbpp1p1p/1p2p3/7B/3PP2q/P1N5/1PP2PPP/R2QK2R w KQkq -
+rn2kb1r/pbpp1p1p/1p2p3/7B/3PP2q/P1N2Q2/1PP2PPP/R3K2R b KQkq -
+rn1k1b1r/pbpp1p1p/1p2p3/7B/3PP2q/P1N2Q2/1PP2PPP/R3K2R w KQ -
+rn1k1b1r/pbpp1Q1p/1p2p3/7B/3PP2q/P1N5/1PP2PPP/R3K2R b KQ -
+r2k1b1r/pbpp1Q1p/1pn1p3/7B/3PP2q/P1N5/1PP2PPP/R3K2R w KQ -
+r2kQb1r/pbpp3p/1pn1p3/7B/3PP2q/P1N5/1PP2PPP/R3K2R b KQ -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/3P4/8/PPP1PPPP/RNBQKBNR b KQkq d3
+rnbqkbnr/ppp1pppp/8/3p4/3P4/8/PPP1PPPP/RNBQKBNR w KQkq d6
+rnbqkbnr/ppp1pppp/8/3p4/3P4/5N2/PPP1PPPP/RNBQKB1R b KQkq -
+rnbqkb1r/ppp1pppp/5n2/3p4/3P4/5N2/PPP1PPPP/RNBQKB1R w KQkq -
+rnbqkb1r/ppp1pppp/5n2/3p4/3P4/4PN2/PPP2PPP/RNBQKB1R b KQkq -
+rn1qkb1r/ppp1pppp/5n2/3p1b2/3P4/4PN2/PPP2PPP/RNBQKB1R w KQkq -
+rn1qkb1r/ppp1pppp/5n2/3p1b2/3P3N/4P3/PPP2PPP/RNBQKB1R b KQkq -
+rn1qkb1r/ppp1pppp/5nb1/3p4/3P3N/4P3/PPP2PPP/RNBQKB1R w KQkq -
+rn1qkb1r/ppp1pppp/5nN1/3p4/3P4/4P3/PPP2PPP/RNBQKB1R b KQkq -
+rn1qkb1r/ppp1ppp1/5np1/3p4/3P4/4P3/PPP2PPP/RNBQKB1R w KQkq -
+rn1qkb1r/ppp1ppp1/5np1/3p4/3P4/4P3/PPPN1PPP/R1BQKB1R b KQkq -
+rn1qkb1r/ppp2pp1/4pnp1/3p4/3P4/4P3/PPPN1PPP/R1BQKB1R w KQkq -
+rn1qkb1r/ppp2pp1/4pnp1/3p4/3P4/3BP3/PPPN1PPP/R1BQK2R b KQkq -
+rn1qk2r/ppp2pp1/3bpnp1/3p4/3P4/3BP3/PPPN1PPP/R1BQK2R w KQkq -
+rn1qk2r/ppp2pp1/3bpnp1/3p4/3PP3/3B4/PPPN1PPP/R1BQK2R b KQkq -
+rn1qk2r/ppp2pp1/3bpnp1/8/3Pp3/3B4/PPPN1PPP/R1BQK2R w KQkq -
+rn1qk2r/ppp2pp1/3bpnp1/8/3PN3/3B4/PPP2PPP/R1BQK2R b KQkq -
+rn1qk3/ppp2pp1/3bpnp1/8/3PN3/3B4/PPP2PPr/R1BQK2R w KQq -
+rn1qk3/ppp2pp1/3bpnp1/8/3PN3/3B4/PPP1KPPr/R1BQ3R b q -
+rn1qk3/ppp2pp1/3bpnp1/8/3PN3/3B4/PPP1KPP1/R1BQ3r w q -
+rn1qk3/ppp2pp1/3bpnp1/8/3PN3/3B4/PPP1KPP1/R1B4Q b q -
+r2qk3/ppp2pp1/2nbpnp1/8/3PN3/3B4/PPP1KPP1/R1B4Q w q -
+r2qk3/ppp2pp1/2nbpnp1/6B1/3PN3/3B4/PPP1KPP1/R6Q b q -
+r2q4/ppp1kpp1/2nbpnp1/6B1/3PN3/3B4/PPP1KPP1/R6Q w - -
+r2q4/ppp1kppQ/2nbpnp1/6B1/3PN3/3B4/PPP1KPP1/R7 b - -
+r2q4/ppp1kppQ/3bpnp1/6B1/3nN3/3B4/PPP1KPP1/R7 w - -
+r2q4/ppp1kppQ/3bpnp1/6B1/3nN3/3B4/PPPK1PP1/R7 b - -
+r3q3/ppp1kppQ/3bpnp1/6B1/3nN3/3B4/PPPK1PP1/R7 w - -
+r3q3/ppp1kpQ1/3bpnp1/6B1/3nN3/3B4/PPPK1PP1/R7 b - -
+r6q/ppp1kpQ1/3bpnp1/6B1/3nN3/3B4/PPPK1PP1/R7 w - -
+r6q/ppp1kpQ1/3bpBp1/8/3nN3/3B4/PPPK1PP1/R7 b - -
+r6q/pppk1pQ1/3bpBp1/8/3nN3/3B4/PPPK1PP1/R7 w - -
+r6Q/pppk1p2/3bpBp1/8/3nN3/3B4/PPPK1PP1/R7 b - -
+7r/pppk1p2/3bpBp1/8/3nN3/3B4/PPPK1PP1/R7 w - -
+7B/pppk1p2/3bp1p1/8/3nN3/3B4/PPPK1PP1/R7 b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppp1ppp/8/4p3/4P3/8/PPPP1PPP/RNBQKBNR w KQkq e6
+rnbqkbnr/pppp1ppp/8/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R b KQkq -
+r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq -
+r1bqkbnr/pppp1ppp/2n5/4p3/2B1P3/5N2/PPPP1PPP/RNBQK2R b KQkq -
+r1bqkb1r/pppp1ppp/2n2n2/4p3/2B1P3/5N2/PPPP1PPP/RNBQK2R w KQkq -
+r1bqkb1r/pppp1ppp/2n2n2/4p3/2B1P3/2N2N2/PPPP1PPP/R1BQK2R b KQkq -
+r1bqk2r/pppp1ppp/2n2n2/2b1p3/2B1P3/2N2N2/PPPP1PPP/R1BQK2R w KQkq -
+r1bqk2r/pppp1ppp/2n2n2/2b1p3/2B1P3/P1N2N2/1PPP1PPP/R1BQK2R b KQkq -
+r1bqk2r/pppp1ppp/2n2n2/4p3/2B1P3/P1N2N2/1PPP1bPP/R1BQK2R w KQkq -
+r1bqk2r/pppp1ppp/2n2n2/4p3/2B1P3/P1N2N2/1PPP1KPP/R1BQ3R b kq -
+r1bqk2r/pppp1ppp/5n2/4p3/2BnP3/P1N2N2/1PPP1KPP/R1BQ3R w kq -
+r1bqk2r/pppp1ppp/5n2/4p3/2BnP3/P1NP1N2/1PP2KPP/R1BQ3R b kq -
+r1bqk2r/pppp1ppp/8/4p3/2BnP1n1/P1NP1N2/1PP2KPP/R1BQ3R w kq -
+r1bqk2r/pppp1ppp/8/4p3/2BnP1n1/P1NP1N2/1PP3PP/R1BQ1K1R b kq -
+r1b1k2r/pppp1ppp/5q2/4p3/2BnP1n1/P1NP1N2/1PP3PP/R1BQ1K1R w kq -
+r1b1k2r/pppp1ppp/5q2/4p3/2BnP1n1/P1NP1N1P/1PP3P1/R1BQ1K1R b kq -
+r1b1k2r/ppp2ppp/5q2/3pp3/2BnP1n1/P1NP1N1P/1PP3P1/R1BQ1K1R w kq d6
+r1b1k2r/ppp2ppp/5q2/3Np3/2BnP1n1/P2P1N1P/1PP3P1/R1BQ1K1R b kq -
+r1b1k2r/ppp2ppp/4q3/3Np3/2BnP1n1/P2P1N1P/1PP3P1/R1BQ1K1R w kq -
+r1b1k2r/ppN2ppp/4q3/4p3/2BnP1n1/P2P1N1P/1PP3P1/R1BQ1K1R b kq -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pp1ppppp/2p5/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq -
+rnbqkbnr/pp1ppppp/2p5/8/4P3/2N5/PPPP1PPP/R1BQKBNR b KQkq -
+rnbqkbnr/pp2pppp/2p5/3p4/4P3/2N5/PPPP1PPP/R1BQKBNR w KQkq d6
+rnbqkbnr/pp2pppp/2p5/3p4/4P3/2N2Q2/PPPP1PPP/R1B1KBNR b KQkq -
+rnbqkbnr/pp2pppp/2p5/8/4p3/2N2Q2/PPPP1PPP/R1B1KBNR w KQkq -
+rnbqkbnr/pp2pppp/2p5/8/4N3/5Q2/PPPP1PPP/R1B1KBNR b KQkq -
+r1bqkbnr/pp1npppp/2p5/8/4N3/5Q2/PPPP1PPP/R1B1KBNR w KQkq -
+r1bqkbnr/pp1npppp/2p5/8/2B1N3/5Q2/PPPP1PPP/R1B1K1NR b KQkq -
+r1bqkb1r/pp1npppp/2p2n2/8/2B1N3/5Q2/PPPP1PPP/R1B1K1NR w KQkq -
+r1bqkb1r/pp1npppp/2p2N2/8/2B5/5Q2/PPPP1PPP/R1B1K1NR b KQkq -
+r1bqkb1r/pp2pppp/2p2n2/8/2B5/5Q2/PPPP1PPP/R1B1K1NR w KQkq -
+r1bqkb1r/pp2pppp/2p2n2/8/2B5/6Q1/PPPP1PPP/R1B1K1NR b KQkq -
+r2qkb1r/pp2pppp/2p2n2/5b2/2B5/6Q1/PPPP1PPP/R1B1K1NR w KQkq -
+r2qkb1r/pp2pppp/2p2n2/5b2/2B5/3P2Q1/PPP2PPP/R1B1K1NR b KQkq -
+r2qkb1r/pp2pppp/2p2nb1/8/2B5/3P2Q1/PPP2PPP/R1B1K1NR w KQkq -
+r2qkb1r/pp2pppp/2p2nb1/8/2B5/3P2Q1/PPP1NPPP/R1B1K2R b KQkq -
+r2qkb1r/pp3ppp/2p1pnb1/8/2B5/3P2Q1/PPP1NPPP/R1B1K2R w KQkq -
+r2qkb1r/pp3ppp/2p1pnb1/8/2B2B2/3P2Q1/PPP1NPPP/R3K2R b KQkq -
+r2qkb1r/pp3ppp/2p1p1b1/7n/2B2B2/3P2Q1/PPP1NPPP/R3K2R w KQkq -
+r2qkb1r/pp3ppp/2p1p1b1/7n/2B2B2/3P1Q2/PPP1NPPP/R3K2R b KQkq -
+r2qkb1r/pp3ppp/2p1p1b1/8/2B2n2/3P1Q2/PPP1NPPP/R3K2R w KQkq -
+r2qkb1r/pp3ppp/2p1p1b1/8/2B2N2/3P1Q2/PPP2PPP/R3K2R b KQkq -
+r2qk2r/pp2bppp/2p1p1b1/8/2B2N2/3P1Q2/PPP2PPP/R3K2R w KQkq -
+r2qk2r/pp2bppp/2p1B1b1/8/5N2/3P1Q2/PPP2PPP/R3K2R b KQkq -
+r2qk2r/pp2b1pp/2p1p1b1/8/5N2/3P1Q2/PPP2PPP/R3K2R w KQkq -
+r2qk2r/pp2b1pp/2p1N1b1/8/8/3P1Q2/PPP2PPP/R3K2R b KQkq -
+r3k2r/pp2b1pp/2p1N1b1/q7/8/3P1Q2/PPP2PPP/R3K2R w KQkq -
+r3k2r/pp2b1pp/2p1N1b1/q7/8/2PP1Q2/PP3PPP/R3K2R b KQkq -
+r3k2r/pp2b1pp/2p1N1b1/4q3/8/2PP1Q2/PP3PPP/R3K2R w KQkq -
+r3k2r/pp2b1pp/2p1N1b1/4q3/8/2PPQ3/PP3PPP/R3K2R b KQkq -
+r3k2r/pp2b1pp/2p1N1b1/8/8/2PPq3/PP3PPP/R3K2R w KQkq -
+r3k2r/pp2b1pp/2p1N1b1/8/8/2PPP3/PP4PP/R3K2R b KQkq -
+r6r/pp1kb1pp/2p1N1b1/8/8/2PPP3/PP4PP/R3K2R w KQ -
+r6r/pp1kb1pp/2p3b1/8/5N2/2PPP3/PP4PP/R3K2R b KQ -
+r6r/pp1k2pp/2pb2b1/8/5N2/2PPP3/PP4PP/R3K2R w KQ -
+r6r/pp1k2pp/2pb2N1/8/8/2PPP3/PP4PP/R3K2R b KQ -
+r6r/pp1k2p1/2pb2p1/8/8/2PPP3/PP4PP/R3K2R w KQ -
+r6r/pp1k2p1/2pb2p1/8/8/2PPP2P/PP4P1/R3K2R b KQ -
+r6r/pp1k2p1/2p3p1/8/8/2PPP1bP/PP4P1/R3K2R w KQ -
+r6r/pp1k2p1/2p3p1/8/8/2PPP1bP/PP1K2P1/R6R b - -
+5r1r/pp1k2p1/2p3p1/8/8/2PPP1bP/PP1K2P1/R6R w - -
+5r1r/pp1k2p1/2p3p1/8/8/2PPP1bP/PP1K2P1/R4R2 b - -
+5r1r/pp2k1p1/2p3p1/8/8/2PPP1bP/PP1K2P1/R4R2 w - -
+5r1r/pp2k1p1/2p3p1/8/3P4/2P1P1bP/PP1K2P1/R4R2 b - -
+7r/pp2k1p1/2p3p1/8/3P4/2P1P1bP/PP1K2P1/R4r2 w - -
+7r/pp2k1p1/2p3p1/8/3P4/2P1P1bP/PP1K2P1/5R2 b - -
+5r2/pp2k1p1/2p3p1/8/3P4/2P1P1bP/PP1K2P1/5R2 w - -
+5R2/pp2k1p1/2p3p1/8/3P4/2P1P1bP/PP1K2P1/8 b - -
+5k2/pp4p1/2p3p1/8/3P4/2P1P1bP/PP1K2P1/8 w - -
+5k2/pp4p1/2p3p1/8/3PP3/2P3bP/PP1K2P1/8 b - -
+8/pp2k1p1/2p3p1/8/3PP3/2P3bP/PP1K2P1/8 w - -
+8/pp2k1p1/2p3p1/8/3PP3/2P1K1bP/PP4P1/8 b - -
+8/pp2k1p1/2p5/6p1/3PP3/2P1K1bP/PP4P1/8 w - -
+8/pp2k1p1/2p5/6p1/3PP3/2P2KbP/PP4P1/8 b - -
+8/pp2k1p1/2p5/6p1/3PP3/2P2K1P/PP4P1/4b3 w - -
+8/pp2k1p1/2p5/6p1/3PP1K1/2P4P/PP4P1/4b3 b - -
+8/pp2k1p1/2p5/6p1/3PP1K1/2P4P/PP1b2P1/8 w - -
+8/pp2k1p1/2p5/5Kp1/3PP3/2P4P/PP1b2P1/8 b - -
+8/pp2k1p1/2p5/5Kp1/3PP3/2P4P/PP4P1/2b5 w - -
+8/pp2k1p1/2p3K1/6p1/3PP3/2P4P/PP4P1/2b5 b - -
+5k2/pp4p1/2p3K1/6p1/3PP3/2P4P/PP4P1/2b5 w - -
+5k2/pp4p1/2p3K1/4P1p1/3P4/2P4P/PP4P1/2b5 b - -
+5k2/pp4p1/2p3K1/4P1p1/3P4/2P4P/Pb4P1/8 w - -
+5k2/pp4p1/2p5/4P1K1/3P4/2P4P/Pb4P1/8 b - -
+5k2/pp4p1/2p5/4P1K1/3P4/2b4P/P5P1/8 w - -
+5k2/pp4p1/2p5/4P1K1/3P3P/2b5/P5P1/8 b - -
+5k2/pp4p1/2p5/4P1K1/3b3P/8/P5P1/8 w - -
+5k2/pp4p1/2p5/4P1KP/3b4/8/P5P1/8 b - -
+5k2/pp4p1/2p5/4b1KP/8/8/P5P1/8 w - -
+5k2/pp4p1/2p5/4b1KP/6P1/8/P7/8 b - g3
+5k2/pp4p1/2p5/6KP/6P1/8/Pb6/8 w - -
+5k2/pp4p1/2p5/5K1P/6P1/8/Pb6/8 b - -
+8/pp3kp1/2p5/5K1P/6P1/8/Pb6/8 w - -
+8/pp3kp1/2p5/5KPP/8/8/Pb6/8 b - -
+8/pp3kp1/2p5/5KPP/8/8/P7/2b5 w - -
+8/pp3kp1/2p3P1/5K1P/8/8/P7/2b5 b - -
+8/pp2k1p1/2p3P1/5K1P/8/8/P7/2b5 w - -
+8/pp2k1p1/2p3P1/4K2P/8/8/P7/2b5 b - -
+8/p3k1p1/2p3P1/1p2K2P/8/8/P7/2b5 w - b6
+8/p3k1p1/2p3P1/1p5P/3K4/8/P7/2b5 b - -
+8/p5p1/2pk2P1/1p5P/3K4/8/P7/2b5 w - -
+8/p5p1/2pk2P1/1p5P/8/2K5/P7/2b5 b - -
+8/p5p1/3k2P1/1pp4P/8/2K5/P7/2b5 w - -
+8/p5p1/3k2P1/1pp4P/8/P1K5/8/2b5 b - -
+8/p5p1/3k2P1/1pp3bP/8/P1K5/8/8 w - -
+8/p5p1/3k2P1/1pp3bP/P7/2K5/8/8 b - -
+8/p5p1/3k2P1/2p3bP/p7/2K5/8/8 w - -
+8/p5p1/3k2P1/2p3bP/p7/8/1K6/8 b - -
+8/p5p1/6P1/2pk2bP/p7/8/1K6/8 w - -
+8/p5p1/6P1/2pk2bP/p7/K7/8/8 b - -
+8/p5p1/6P1/2p3bP/p2k4/K7/8/8 w - -
+8/p5p1/6P1/2p3bP/K2k4/8/8/8 b - -
+8/p5p1/6P1/6bP/K1pk4/8/8/8 w - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppp1ppp/4p3/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppp1ppp/4p3/8/4PP2/8/PPPP2PP/RNBQKBNR b KQkq f3
+rnbqkbnr/ppp2ppp/4p3/3p4/4PP2/8/PPPP2PP/RNBQKBNR w KQkq d6
+rnbqkbnr/ppp2ppp/4p3/3pP3/5P2/8/PPPP2PP/RNBQKBNR b KQkq -
+rnbqkbnr/pp3ppp/4p3/2ppP3/5P2/8/PPPP2PP/RNBQKBNR w KQkq c6
+rnbqkbnr/pp3ppp/4p3/2ppP3/5P2/5N2/PPPP2PP/RNBQKB1R b KQkq -
+rnb1kbnr/pp3ppp/1q2p3/2ppP3/5P2/5N2/PPPP2PP/RNBQKB1R w KQkq -
+rnb1kbnr/pp3ppp/1q2p3/2ppP3/5P2/2P2N2/PP1P2PP/RNBQKB1R b KQkq -
+r1b1kbnr/pp3ppp/1qn1p3/2ppP3/5P2/2P2N2/PP1P2PP/RNBQKB1R w KQkq -
+r1b1kbnr/pp3ppp/1qn1p3/2ppP3/5P2/2PP1N2/PP4PP/RNBQKB1R b KQkq -
+r3kbnr/pp1b1ppp/1qn1p3/2ppP3/5P2/2PP1N2/PP4PP/RNBQKB1R w KQkq -
+r3kbnr/pp1b1ppp/1qn1p3/2ppP3/5P2/2PP1N2/PP2B1PP/RNBQK2R b KQkq -
+r3kb1r/pp1b1ppp/1qn1p2n/2ppP3/5P2/2PP1N2/PP2B1PP/RNBQK2R w KQkq -
+r3kb1r/pp1b1ppp/1qn1p2n/2ppP3/5P2/2PP1N2/PP2B1PP/RNBQ1RK1 b kq -
+r3kb1r/pp1b1ppp/1qn1p3/2ppPn2/5P2/2PP1N2/PP2B1PP/RNBQ1RK1 w kq -
+r3kb1r/pp1b1ppp/1qn1p3/2ppPn2/5PP1/2PP1N2/PP2B2P/RNBQ1RK1 b kq g3
+r3kb1r/pp1b1ppp/1qn1p2n/2ppP3/5PP1/2PP1N2/PP2B2P/RNBQ1RK1 w kq -
+r3kb1r/pp1b1ppp/1qn1p2n/2ppP3/5PP1/2PP1N2/PP2B1KP/RNBQ1R2 b kq -
+r3kb1r/pp1b1ppp/1qn1p3/2ppP3/5Pn1/2PP1N2/PP2B1KP/RNBQ1R2 w kq -
+r3kb1r/pp1b1ppp/1qn1p3/2ppP3/5Pn1/2PP1N1P/PP2B1K1/RNBQ1R2 b kq -
+r3kb1r/pp1b1ppp/1qn1p2n/2ppP3/5P2/2PP1N1P/PP2B1K1/RNBQ1R2 w kq -
+r3kb1r/pp1b1ppp/1qn1p2n/2ppP1N1/5P2/2PP3P/PP2B1K1/RNBQ1R2 b kq -
+r3kb1r/pp1b1ppp/1qn1p3/2ppPnN1/5P2/2PP3P/PP2B1K1/RNBQ1R2 w kq -
+r3kb1r/pp1b1ppp/1qn1p3/2ppPnN1/5PB1/2PP3P/PP4K1/RNBQ1R2 b kq -
+r3kb1r/pp1bnppp/1q2p3/2ppPnN1/5PB1/2PP3P/PP4K1/RNBQ1R2 w kq -
+r3kb1r/pp1bnppp/1q2p3/2ppPnN1/5PB1/2PP3P/PP1N2K1/R1BQ1R2 b kq -
+r3kb1r/pp1bnppp/1q2p3/2ppP1N1/5PB1/2PPn2P/PP1N2K1/R1BQ1R2 w kq -
+r3kb1r/pp1bnppp/1q2p3/2ppP1N1/5PB1/2PPnK1P/PP1N4/R1BQ1R2 b kq -
+r3kb1r/pp1bnppp/1q2p3/2ppP1N1/5PB1/2PP1K1P/PP1N4/R1Bn1R2 w kq -
+r3kb1r/pp1bnppp/1q2p3/2ppP1N1/5PB1/2PP1K1P/PP1N4/R1BR4 b kq -
+r3kb1r/pp1bnpp1/1q2p2p/2ppP1N1/5PB1/2PP1K1P/PP1N4/R1BR4 w kq -
+r3kb1r/pp1bnNp1/1q2p2p/2ppP3/5PB1/2PP1K1P/PP1N4/R1BR4 b kq -
+r4b1r/pp1bnkp1/1q2p2p/2ppP3/5PB1/2PP1K1P/PP1N4/R1BR4 w - -
+r4b1r/pp1bnkp1/1q2p2p/2ppP3/5PB1/2PP1K1P/PP1N4/R1B2R2 b - -
+r4b1r/pp1bnkp1/1q2p3/2ppP2p/5PB1/2PP1K1P/PP1N4/R1B2R2 w - -
+r4b1r/pp1bnkp1/1q2B3/2ppP2p/5P2/2PP1K1P/PP1N4/R1B2R2 b - -
+r4b1r/pp2nkp1/1q2b3/2ppP2p/5P2/2PP1K1P/PP1N4/R1B2R2 w - -
+r4b1r/pp2nkp1/1q2b3/2ppP2p/5P2/2PP2KP/PP1N4/R1B2R2 b - -
+r4b1r/pp3kp1/1q2b3/2ppPn1p/5P2/2PP2KP/PP1N4/R1B2R2 w - -
+r4b1r/pp3kp1/1q2b3/2ppPn1p/5P2/2PP3P/PP1N2K1/R1B2R2 b - -
+r4b1r/pp3kp1/1q2b3/2ppP2p/5P2/2PPn2P/PP1N2K1/R1B2R2 w - -
+r4b1r/pp3kp1/1q2b3/2ppP2p/5P2/2PPn2P/PP1N1K2/R1B2R2 b - -
+r4b1r/pp3kp1/1q2b3/2ppP2p/5P2/2PP3P/PP1N1K2/R1B2n2 w - -
+r4b1r/pp3kp1/1q2b3/2ppP2p/5P2/2PP3P/PP1N4/R1B2K2 b - -
+r4b1r/pp3kp1/1q6/2ppP2p/5P2/2PP3b/PP1N4/R1B2K2 w - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/p1pppppp/1p6/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq -
+rnbqkbnr/p1pppppp/1p6/8/2B1P3/8/PPPP1PPP/RNBQK1NR b KQkq -
+rn1qkbnr/pbpppppp/1p6/8/2B1P3/8/PPPP1PPP/RNBQK1NR w KQkq -
+rn1qkbnr/pbpppppp/1p6/8/2B1P3/3P4/PPP2PPP/RNBQK1NR b KQkq -
+rn1qkb1r/pbpppppp/1p5n/8/2B1P3/3P4/PPP2PPP/RNBQK1NR w KQkq -
+rn1qkb1r/pbpppppp/1p5B/8/2B1P3/3P4/PPP2PPP/RN1QK1NR b KQkq -
+rn1qkb1r/pbpppp1p/1p5p/8/2B1P3/3P4/PPP2PPP/RN1QK1NR w KQkq -
+rn1qkb1r/pbpppp1p/1p5p/8/2B1P3/3P1Q2/PPP2PPP/RN2K1NR b KQkq -
+rn1qkb1r/pbpp1p1p/1p2p2p/8/2B1P3/3P1Q2/PPP2PPP/RN2K1NR w KQkq -
+rn1qkb1r/pbpp1p1p/1p2p2p/8/2B1P3/3P1Q1N/PPP2PPP/RN2K2R b KQkq -
+rn1qk2r/pbpp1pbp/1p2p2p/8/2B1P3/3P1Q1N/PPP2PPP/RN2K2R w KQkq -
+rn1qk2r/pbpp1pbp/1p2p2p/8/2B1P3/2PP1Q1N/PP3PPP/RN2K2R b KQkq -
+r2qk2r/pbpp1pbp/1pn1p2p/8/2B1P3/2PP1Q1N/PP3PPP/RN2K2R w KQkq -
+r2qk2r/pbpp1pbp/1pn1p2p/8/2B1P3/2PP2QN/PP3PPP/RN2K2R b KQkq -
+r2qk1r1/pbpp1pbp/1pn1p2p/8/2B1P3/2PP2QN/PP3PPP/RN2K2R w KQq -
+r2qk1r1/pbpp1pbp/1pn1p2p/8/2B1P3/2PP1Q1N/PP3PPP/RN2K2R b KQq -
+r2qk1r1/pbpp1pbp/1p2p2p/4n3/2B1P3/2PP1Q1N/PP3PPP/RN2K2R w KQq -
+r2qk1r1/pbpp1pbp/1p2p2p/4n3/2B1P3/2PPQ2N/PP3PPP/RN2K2R b KQq -
+r2qk1r1/pbpp1pbp/1p2p2p/8/2n1P3/2PPQ2N/PP3PPP/RN2K2R w KQq -
+r2qk1r1/pbpp1pbp/1p2p2p/8/2P1P3/2P1Q2N/PP3PPP/RN2K2R b KQq -
+r3k1r1/pbppqpbp/1p2p2p/8/2P1P3/2P1Q2N/PP3PPP/RN2K2R w KQq -
+r3k1r1/pbppqpbp/1p2p2p/8/2P1P3/2P1Q2N/PP3PPP/RN3RK1 b q -
+r3k1r1/pbpp1pbp/1p2p2p/2q5/2P1P3/2P1Q2N/PP3PPP/RN3RK1 w q -
+r3k1r1/pbpp1pbp/1p2p2p/2Q5/2P1P3/2P4N/PP3PPP/RN3RK1 b q -
+r3k1r1/pbpp1pbp/4p2p/1pQ5/2P1P3/2P4N/PP3PPP/RN3RK1 w q -
+r3k1r1/pbpp1pbp/4p2p/1Q6/2P1P3/2P4N/PP3PPP/RN3RK1 b q -
+r3k1r1/p1pp1pbp/4p2p/1Q6/2P1b3/2P4N/PP3PPP/RN3RK1 w q -
+r3k1r1/p1pp1pbp/4p2p/1Q6/2P1b3/2P4N/PP1N1PPP/R4RK1 b q -
+r3k1r1/p1pp1pbp/2b1p2p/1Q6/2P5/2P4N/PP1N1PPP/R4RK1 w q -
+r3k1r1/p1pp1pbp/2b1p2p/8/2P5/1QP4N/PP1N1PPP/R4RK1 b q -
+r3k1r1/p1pp1p1p/2b1p2p/8/2P5/1Qb4N/PP1N1PPP/R4RK1 w q -
+r3k1r1/p1pp1p1p/2b1p2p/8/2P5/1Qb3PN/PP1N1P1P/R4RK1 b q -
+r3k1r1/p1pp1p1p/2b1p2p/8/2P5/1Q4PN/PP1b1P1P/R4RK1 w q -
+r3k1r1/p1pp1p1p/2b1p2p/8/2P5/1Q4PN/PP1b1P1P/3R1RK1 b q -
+r3k1r1/p1pp1p1p/2b1p2p/6b1/2P5/1Q4PN/PP3P1P/3R1RK1 w q -
+r3k1r1/p1pp1p1p/2b1p2p/6N1/2P5/1Q4P1/PP3P1P/3R1RK1 b q -
+r3k1r1/p1pp1p1p/2b1p3/6p1/2P5/1Q4P1/PP3P1P/3R1RK1 w q -
+r3k1r1/p1pp1p1p/2b1p3/6p1/2P5/3Q2P1/PP3P1P/3R1RK1 b q -
+r3k1r1/p1pp1p2/2b1p2p/6p1/2P5/3Q2P1/PP3P1P/3R1RK1 w q -
+r3k1r1/p1pp1p2/2b1p2p/6p1/1PP5/3Q2P1/P4P1P/3R1RK1 b q b3
+r3k1r1/p1pp1p2/4p2p/6p1/bPP5/3Q2P1/P4P1P/3R1RK1 w q -
+r3k1r1/p1pp1p2/4p2p/6p1/bPP5/3Q2P1/P2R1P1P/5RK1 b q -
+1r2k1r1/p1pp1p2/4p2p/6p1/bPP5/3Q2P1/P2R1P1P/5RK1 w - -
+1r2k1r1/p1pp1p2/4p2p/1P4p1/b1P5/3Q2P1/P2R1P1P/5RK1 b - -
+1r2k1r1/p1p2p2/3pp2p/1P4p1/b1P5/3Q2P1/P2R1P1P/5RK1 w - -
+1r2k1r1/p1p2p2/3pp2p/1P4p1/b1P5/Q5P1/P2R1P1P/5RK1 b - -
+1r2k1r1/p1p2p2/3pp2p/1b4p1/2P5/Q5P1/P2R1P1P/5RK1 w - -
+1r2k1r1/p1p2p2/3pp2p/1P4p1/8/Q5P1/P2R1P1P/5RK1 b - -
+4k1r1/p1p2p2/3pp2p/1r4p1/8/Q5P1/P2R1P1P/5RK1 w - -
+4k1r1/Q1p2p2/3pp2p/1r4p1/8/6P1/P2R1P1P/5RK1 b - -
+4k1r1/Q1p2p2/3pp2p/2r3p1/8/6P1/P2R1P1P/5RK1 w - -
+Q3k1r1/2p2p2/3pp2p/2r3p1/8/6P1/P2R1P1P/5RK1 b - -
+Q5r1/2p1kp2/3pp2p/2r3p1/8/6P1/P2R1P1P/5RK1 w - -
+6Q1/2p1kp2/3pp2p/2r3p1/8/6P1/P2R1P1P/5RK1 b - -
+6Q1/2p1kp2/3p3p/2r1p1p1/8/6P1/P2R1P1P/5RK1 w - -
+7Q/2p1kp2/3p3p/2r1p1p1/8/6P1/P2R1P1P/5RK1 b - -
+7Q/2p1kp2/7p/2rpp1p1/8/6P1/P2R1P1P/5RK1 w - -
+8/2p1kp2/7p/2rpQ1p1/8/6P1/P2R1P1P/5RK1 b - -
+8/2pk1p2/7p/2rpQ1p1/8/6P1/P2R1P1P/5RK1 w - -
+8/2pk1p2/7p/2rRQ1p1/8/6P1/P4P1P/5RK1 b - -
+8/2pk1p2/7p/3rQ1p1/8/6P1/P4P1P/5RK1 w - -
+8/2pk1p2/7p/3Q2p1/8/6P1/P4P1P/5RK1 b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppp1ppp/8/4p3/4P3/8/PPPP1PPP/RNBQKBNR w KQkq e6
+rnbqkbnr/pppp1ppp/8/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R b KQkq -
+r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq -
+r1bqkbnr/pppp1ppp/2n5/4p3/2B1P3/5N2/PPPP1PPP/RNBQK2R b KQkq -
+r1bqkb1r/pppp1ppp/2n2n2/4p3/2B1P3/5N2/PPPP1PPP/RNBQK2R w KQkq -
+r1bqkb1r/pppp1ppp/2n2n2/4p3/2B1P3/3P1N2/PPP2PPP/RNBQK2R b KQkq -
+r1bqk2r/pppp1ppp/2n2n2/2b1p3/2B1P3/3P1N2/PPP2PPP/RNBQK2R w KQkq -
+r1bqk2r/pppp1ppp/2n2n2/2b1p3/2B1P3/2PP1N2/PP3PPP/RNBQK2R b KQkq -
+r1bq1rk1/pppp1ppp/2n2n2/2b1p3/2B1P3/2PP1N2/PP3PPP/RNBQK2R w KQ -
+r1bq1rk1/pppp1ppp/2n2n2/2b1p3/2B1P3/2PP1N2/PP3PPP/RNBQ1RK1 b - -
+r1bq1rk1/ppp2ppp/2np1n2/2b1p3/2B1P3/2PP1N2/PP3PPP/RNBQ1RK1 w - -
+r1bq1rk1/ppp2ppp/2np1n2/2b1p1B1/2B1P3/2PP1N2/PP3PPP/RN1Q1RK1 b - -
+r1bq1rk1/ppp2ppp/3p1n2/n1b1p1B1/2B1P3/2PP1N2/PP3PPP/RN1Q1RK1 w - -
+r1bq1rk1/ppp2ppp/3p1n2/n1b1p1B1/4P3/1BPP1N2/PP3PPP/RN1Q1RK1 b - -
+r1bq1rk1/ppp2ppp/3p1n2/2b1p1B1/4P3/1nPP1N2/PP3PPP/RN1Q1RK1 w - -
+r1bq1rk1/ppp2ppp/3p1n2/2b1p1B1/4P3/1QPP1N2/PP3PPP/RN3RK1 b - -
+r2q1rk1/ppp2ppp/3pbn2/2b1p1B1/4P3/1QPP1N2/PP3PPP/RN3RK1 w - -
+r2q1rk1/pQp2ppp/3pbn2/2b1p1B1/4P3/2PP1N2/PP3PPP/RN3RK1 b - -
+1r1q1rk1/pQp2ppp/3pbn2/2b1p1B1/4P3/2PP1N2/PP3PPP/RN3RK1 w - -
+1r1q1rk1/p1p2ppp/Q2pbn2/2b1p1B1/4P3/2PP1N2/PP3PPP/RN3RK1 b - -
+3q1rk1/p1p2ppp/Q2pbn2/2b1p1B1/4P3/2PP1N2/Pr3PPP/RN3RK1 w - -
+3q1rk1/p1p2ppp/Q2pbn2/2b1p1B1/4P3/2PP1N2/Pr1N1PPP/R4RK1 b - -
+3q1rk1/p1p2ppp/Q2pbn2/2b1p1B1/4P3/2PP1N2/P2r1PPP/R4RK1 w - -
+3q1rk1/p1p2ppp/Q2pbn2/2b1p1B1/4P3/2PP4/P2N1PPP/R4RK1 b - -
+3q1rk1/p1p2pp1/Q2pbn1p/2b1p1B1/4P3/2PP4/P2N1PPP/R4RK1 w - -
+3q1rk1/p1p2pp1/Q2pbn1p/2b1p3/4P2B/2PP4/P2N1PPP/R4RK1 b - -
+3q1rk1/p1p2p2/Q2pbn1p/2b1p1p1/4P2B/2PP4/P2N1PPP/R4RK1 w - g6
+3q1rk1/p1p2p2/Q2pbn1p/2b1p1p1/4P3/2PP2B1/P2N1PPP/R4RK1 b - -
+3q1rk1/p1p2p2/Q2pbn2/2b1p1pp/4P3/2PP2B1/P2N1PPP/R4RK1 w - -
+3q1rk1/p1p2p2/Q2pbn2/2b1p1pp/4P3/2PP2BP/P2N1PP1/R4RK1 b - -
+3q1rk1/p1p2p2/Q2pbn2/2b1p1p1/4P2p/2PP2BP/P2N1PP1/R4RK1 w - -
+3q1rk1/p1p2p2/Q2pbn2/2b1p1p1/4P2p/2PP3P/P2N1PPB/R4RK1 b - -
+5rk1/p1pq1p2/Q2pbn2/2b1p1p1/4P2p/2PP3P/P2N1PPB/R4RK1 w - -
+5rk1/p1pq1p2/Q2pbn2/2b1p1p1/4P2p/2PP1N1P/P4PPB/R4RK1 b - -
+5rk1/p1pq1p2/Q2p1n2/2b1p1p1/4P2p/2PP1N1b/P4PPB/R4RK1 w - -
+5rk1/p1pq1p2/Q2p1n2/2b1p1N1/4P2p/2PP3b/P4PPB/R4RK1 b - -
+5rk1/p1p2p2/Q2p1n2/2b1p1N1/4P1qp/2PP3b/P4PPB/R4RK1 w - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppp1ppp/8/4p3/4P3/8/PPPP1PPP/RNBQKBNR w KQkq e6
+rnbqkbnr/pppp1ppp/8/4p3/2P1P3/8/PP1P1PPP/RNBQKBNR b KQkq c3
+rnbqk1nr/pppp1ppp/8/2b1p3/2P1P3/8/PP1P1PPP/RNBQKBNR w KQkq -
+rnbqk1nr/pppp1ppp/8/2b1p3/2P1P3/5N2/PP1P1PPP/RNBQKB1R b KQkq -
+rnbqk1nr/ppp2ppp/3p4/2b1p3/2P1P3/5N2/PP1P1PPP/RNBQKB1R w KQkq -
+rnbqk1nr/ppp2ppp/3p4/2b1p3/2P1P3/3P1N2/PP3PPP/RNBQKB1R b KQkq -
+rnbqk1nr/1pp2ppp/p2p4/2b1p3/2P1P3/3P1N2/PP3PPP/RNBQKB1R w KQkq -
+rnbqk1nr/1pp2ppp/p2p4/2b1p3/2P1P3/P2P1N2/1P3PPP/RNBQKB1R b KQkq -
+rn1qk1nr/1pp2ppp/p2p4/2b1p3/2P1P1b1/P2P1N2/1P3PPP/RNBQKB1R w KQkq -
+rn1qk1nr/1pp2ppp/p2p4/2b1p3/2P1P1b1/P2P1N1P/1P3PP1/RNBQKB1R b KQkq -
+rn1qk1nr/1pp2ppp/p2p4/2b1p3/2P1P3/P2P1b1P/1P3PP1/RNBQKB1R w KQkq -
+rn1qk1nr/1pp2ppp/p2p4/2b1p3/2P1P3/P2P1Q1P/1P3PP1/RNB1KB1R b KQkq -
+rn2k1nr/1pp2ppp/p2p1q2/2b1p3/2P1P3/P2P1Q1P/1P3PP1/RNB1KB1R w KQkq -
+rn2k1nr/1pp2ppp/p2p1q2/2b1p3/2P1P3/P2P1Q1P/1P2BPP1/RNB1K2R b KQkq -
+r3k1nr/1ppn1ppp/p2p1q2/2b1p3/2P1P3/P2P1Q1P/1P2BPP1/RNB1K2R w KQkq -
+r3k1nr/1ppn1ppp/p2p1q2/2b1p3/2P1P3/P1NP1Q1P/1P2BPP1/R1B1K2R b KQkq -
+r3k2r/1ppnnppp/p2p1q2/2b1p3/2P1P3/P1NP1Q1P/1P2BPP1/R1B1K2R w KQkq -
+r3k2r/1ppnnppp/p2p1q2/2b1p3/2P1P3/P1NP1Q1P/1P2BPP1/R1B2RK1 b kq -
+r3k2r/1ppnnppp/p2p1q2/4p3/2PbP3/P1NP1Q1P/1P2BPP1/R1B2RK1 w kq -
+r3k2r/1ppnnppp/p2p1q2/4p3/2PbP3/P1NP1Q1P/1P1BBPP1/R4RK1 b kq -
+r3k2r/1ppnnpp1/p2p1q1p/4p3/2PbP3/P1NP1Q1P/1P1BBPP1/R4RK1 w kq -
+r3k2r/1ppnnpp1/p2p1q1p/4p3/2PbP3/P1NP1Q1P/1P1BBPP1/1R3RK1 b kq -
+r3k2r/1ppnnp2/p2p1q1p/4p1p1/2PbP3/P1NP1Q1P/1P1BBPP1/1R3RK1 w kq g6
+r3k2r/1ppnnp2/p2p1q1p/4p1p1/2PbP1Q1/P1NP3P/1P1BBPP1/1R3RK1 b kq -
+r3k2r/1p1nnp2/p1pp1q1p/4p1p1/2PbP1Q1/P1NP3P/1P1BBPP1/1R3RK1 w kq -
+r3k2r/1p1nnp2/p1pp1q1p/4p1p1/2PbP1Q1/P1NPB2P/1P2BPP1/1R3RK1 b kq -
+r3k2r/bp1nnp2/p1pp1q1p/4p1p1/2P1P1Q1/P1NPB2P/1P2BPP1/1R3RK1 w kq -
+r3k2r/Bp1nnp2/p1pp1q1p/4p1p1/2P1P1Q1/P1NP3P/1P2BPP1/1R3RK1 b kq -
+4k2r/rp1nnp2/p1pp1q1p/4p1p1/2P1P1Q1/P1NP3P/1P2BPP1/1R3RK1 w k -
+4k2r/rp1nnp2/p1pp1q1p/4p1p1/1PP1P1Q1/P1NP3P/4BPP1/1R3RK1 b k b3
+4k2r/rp1nnp2/p1pp2qp/4p1p1/1PP1P1Q1/P1NP3P/4BPP1/1R3RK1 w k -
+4k2r/rp1nnp2/p1pp2qp/4p1p1/NPP1P1Q1/P2P3P/4BPP1/1R3RK1 b k -
+4k2r/rp1nnp2/p1pp2q1/4p1pp/NPP1P1Q1/P2P3P/4BPP1/1R3RK1 w k -
+4k2r/rp1nnp2/p1pp2q1/4p1pp/NPP1P3/P2P2QP/4BPP1/1R3RK1 b k -
+4k2r/rp2np2/p1pp1nq1/4p1pp/NPP1P3/P2P2QP/4BPP1/1R3RK1 w k -
+4k2r/rp2np2/p1pp1nq1/4p1pp/NPP1P3/P2PQ2P/4BPP1/1R3RK1 b k -
+r3k2r/1p2np2/p1pp1nq1/4p1pp/NPP1P3/P2PQ2P/4BPP1/1R3RK1 w k -
+r3k2r/1p2np2/pNpp1nq1/4p1pp/1PP1P3/P2PQ2P/4BPP1/1R3RK1 b k -
+1r2k2r/1p2np2/pNpp1nq1/4p1pp/1PP1P3/P2PQ2P/4BPP1/1R3RK1 w k -
+1r2k2r/1p2np2/pNpp1nq1/2P1p1pp/1P2P3/P2PQ2P/4BPP1/1R3RK1 b k -
+1r2k2r/1p2np2/pNp2nq1/2Ppp1pp/1P2P3/P2PQ2P/4BPP1/1R3RK1 w k -
+1r2k2r/1p2np2/pNp2nq1/2PPp1pp/1P6/P2PQ2P/4BPP1/1R3RK1 b k -
+1r2k2r/1p2np2/pNp3q1/2Pnp1pp/1P6/P2PQ2P/4BPP1/1R3RK1 w k -
+1r2k2r/1p2np2/pNp3q1/2PnQ1pp/1P6/P2P3P/4BPP1/1R3RK1 b k -
+3rk2r/1p2np2/pNp3q1/2PnQ1pp/1P6/P2P3P/4BPP1/1R3RK1 w k -
+3rk2Q/1p2np2/pNp3q1/2Pn2pp/1P6/P2P3P/4BPP1/1R3RK1 b - -
+3rk1nQ/1p3p2/pNp3q1/2Pn2pp/1P6/P2P3P/4BPP1/1R3RK1 w - -
+3rk1nQ/1p3p2/pNp3q1/2Pn2pB/1P6/P2P3P/5PP1/1R3RK1 b - -
+3rk1nQ/1p3p2/pNp4q/2Pn2pB/1P6/P2P3P/5PP1/1R3RK1 w - -
+3rk1nQ/1p3p2/pNp4q/2Pn2pB/1P6/P2P3P/5PP1/4RRK1 b - -
+3rk1nQ/1p2np2/pNp4q/2P3pB/1P6/P2P3P/5PP1/4RRK1 w - -
+3rk1nQ/1p2Rp2/pNp4q/2P3pB/1P6/P2P3P/5PP1/5RK1 b - -
+3r2nQ/1p2kp2/pNp4q/2P3pB/1P6/P2P3P/5PP1/5RK1 w - -
+3r2nQ/1p2kp2/pNp4q/2P3pB/1P6/P2P3P/5PP1/4R1K1 b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/3P4/8/PPP1PPPP/RNBQKBNR b KQkq d3
+rnbqkbnr/pp1ppppp/8/2p5/3P4/8/PPP1PPPP/RNBQKBNR w KQkq c6
+rnbqkbnr/pp1ppppp/8/2p5/2PP4/8/PP2PPPP/RNBQKBNR b KQkq c3
+rnbqkbnr/pp2pppp/3p4/2p5/2PP4/8/PP2PPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pp2pppp/3p4/2p5/2PP1B2/8/PP2PPPP/RN1QKBNR b KQkq -
+rnbqkbnr/pp2pp1p/3p2p1/2p5/2PP1B2/8/PP2PPPP/RN1QKBNR w KQkq -
+rnbqkbnr/pp2pp1p/3p2p1/2p5/2PP1B2/5N2/PP2PPPP/RN1QKB1R b KQkq -
+rnbqk1nr/pp2pp1p/3p2pb/2p5/2PP1B2/5N2/PP2PPPP/RN1QKB1R w KQkq -
+rnbqk1nr/pp2pp1p/3p2pB/2p5/2PP4/5N2/PP2PPPP/RN1QKB1R b KQkq -
+rnbqk2r/pp2pp1p/3p2pn/2p5/2PP4/5N2/PP2PPPP/RN1QKB1R w KQkq -
+rnbqk2r/pp2pp1p/3p2pn/2p5/2PP4/2N2N2/PP2PPPP/R2QKB1R b KQkq -
+rnbqk2r/pp2pp1p/3p2p1/2p2n2/2PP4/2N2N2/PP2PPPP/R2QKB1R w KQkq -
+rnbqk2r/pp2pp1p/3p2p1/2pP1n2/2P5/2N2N2/PP2PPPP/R2QKB1R b KQkq -
+rnbq1rk1/pp2pp1p/3p2p1/2pP1n2/2P5/2N2N2/PP2PPPP/R2QKB1R w KQ -
+rnbq1rk1/pp2pp1p/3p2p1/2pP1n2/2P1P3/2N2N2/PP3PPP/R2QKB1R b KQ e3
+rnbq1rk1/pp2pp1p/3p2p1/2pP4/2PnP3/2N2N2/PP3PPP/R2QKB1R w KQ -
+rnbq1rk1/pp2pp1p/3p2p1/2pP4/2PnP3/2NB1N2/PP3PPP/R2QK2R b KQ -
+rn1q1rk1/pp1bpp1p/3p2p1/2pP4/2PnP3/2NB1N2/PP3PPP/R2QK2R w KQ -
+rn1q1rk1/pp1bpp1p/3p2p1/2pP4/2PnP3/2NB1N2/PP3PPP/R2Q1RK1 b - -
+rn1q1rk1/1p1bpp1p/p2p2p1/2pP4/2PnP3/2NB1N2/PP3PPP/R2Q1RK1 w - -
+rn1q1rk1/1p1bpp1p/p2p2p1/2pP2N1/2PnP3/2NB4/PP3PPP/R2Q1RK1 b - -
+rn1q1rk1/1p1bpp2/p2p2p1/2pP2Np/2PnP3/2NB4/PP3PPP/R2Q1RK1 w - h6
+rn1q1rk1/1p1bpp2/p2p2p1/2pP2Np/2PnP3/2NB4/PP3PPP/R2QR1K1 b - -
+rn1q1rk1/1p1b1p2/p2pp1p1/2pP2Np/2PnP3/2NB4/PP3PPP/R2QR1K1 w - -
+rn1q1rk1/1p1b1p2/p2pP1p1/2p3Np/2PnP3/2NB4/PP3PPP/R2QR1K1 b - -
+rn1q1rk1/1p1b1p2/p2pn1p1/2p3Np/2P1P3/2NB4/PP3PPP/R2QR1K1 w - -
+rn1q1rk1/1p1b1p2/p2pN1p1/2p4p/2P1P3/2NB4/PP3PPP/R2QR1K1 b - -
+rn1q1rk1/1p3p2/p2pb1p1/2p4p/2P1P3/2NB4/PP3PPP/R2QR1K1 w - -
+rn1q1rk1/1p3p2/p2pb1p1/2pN3p/2P1P3/3B4/PP3PPP/R2QR1K1 b - -
+rn1q1rk1/1p3p2/p2pb1p1/2pN4/2P1P2p/3B4/PP3PPP/R2QR1K1 w - -
+rn1q1rk1/1p3p2/p2pb1p1/2pN4/2P1P2p/3B3P/PP3PP1/R2QR1K1 b - -
+rn1q1rk1/1p3p2/p2p2p1/2pN4/2P1P2p/3B3b/PP3PP1/R2QR1K1 w - -
+rn1q1rk1/1p3p2/p2p2p1/2pN4/2P1P2p/3B3P/PP3P2/R2QR1K1 b - -
+rn3rk1/1p3p2/p2p2p1/2pN2q1/2P1P2p/3B3P/PP3P2/R2QR1K1 w - -
+rn3rk1/1p3p2/p2p2p1/2pN2q1/2P1P2p/3B3P/PP3P2/R2QRK2 b - -
+r4rk1/1p1n1p2/p2p2p1/2pN2q1/2P1P2p/3B3P/PP3P2/R2QRK2 w - -
+r4rk1/1p1n1p2/p2p2p1/2pN2q1/Q1P1P2p/3B3P/PP3P2/R3RK2 b - -
+r4rk1/1p3p2/p2p1np1/2pN2q1/Q1P1P2p/3B3P/PP3P2/R3RK2 w - -
+r4rk1/1p2Np2/p2p1np1/2p3q1/Q1P1P2p/3B3P/PP3P2/R3RK2 b - -
+r4r1k/1p2Np2/p2p1np1/2p3q1/Q1P1P2p/3B3P/PP3P2/R3RK2 w - -
+r4r1k/1p2Np2/p2p1np1/2p3q1/Q1P1P2p/3B1P1P/PP6/R3RK2 b - -
+r4r1k/1p2Np2/p2p1np1/2p5/Q1P1P2p/3B1PqP/PP6/R3RK2 w - -
+r4r1k/1p2Np2/p2p1np1/2p5/Q1P1P2p/3B1PqP/PP2K3/R3R3 b - -
+r4r1k/1p2Np2/p2p1np1/2p5/Q1P1P2p/3B1P1q/PP2K3/R3R3 w - -
+r4r1k/1p2Np2/p2p1np1/2p5/Q1P1P2p/3B1P1q/PP2K3/R6R b - -
+r4r1k/1p2Np2/p2p1np1/2p5/Q1P1P2p/3B1P2/PP2K1q1/R6R w - -
+r4r1k/1p2Np2/p2p1np1/2p5/Q1P1P2p/3BKP2/PP4q1/R6R b - -
+r4r1k/1p2Np2/p2p1np1/2p5/Q1P1P3/3BKP1p/PP4q1/R6R w - -
+r4r1k/1p2Np2/p2p1np1/2p5/2P1P3/3BKP1p/PP4q1/R2Q3R b - -
+4rr1k/1p2Np2/p2p1np1/2p5/2P1P3/3BKP1p/PP4q1/R2Q3R w - -
+4rr1k/1p2Np2/p2p1np1/2p5/2P1P3/4KP1p/PP4q1/R2Q1B1R b - -
+4rr1k/1p2Np2/p2p2p1/2p5/2P1P1n1/4KP1p/PP4q1/R2Q1B1R w - -
+4rr1k/1p2Np2/p2p2p1/2p5/2P1P1n1/3K1P1p/PP4q1/R2Q1B1R b - -
+4rr1k/1p2Np2/p2p2p1/2p1n3/2P1P3/3K1P1p/PP4q1/R2Q1B1R w - -
+4rr1k/1p2Np2/p2p2p1/2p1n3/2P1P3/2K2P1p/PP4q1/R2Q1B1R b - -
+4rr1k/1p2Np2/p2p2p1/2p1n3/2P1P3/2K2Pqp/PP6/R2Q1B1R w - -
+4rr1k/1p2Np2/p2p2p1/2p1n3/2P1P3/2K2PqR/PP6/R2Q1B2 b - -
+4rr1k/1p2Np2/p2p2p1/2p1n3/2P1P3/2K2P1q/PP6/R2Q1B2 w - -
+4rr1k/1p2Np2/p2p2p1/2p1n3/2P1P3/2K2P1B/PP6/R2Q4 b - -
+5r1k/1p2rp2/p2p2p1/2p1n3/2P1P3/2K2P1B/PP6/R2Q4 w - -
+5r1k/1p2rp2/p2Q2p1/2p1n3/2P1P3/2K2P1B/PP6/R7 b - -
+5r1k/1p2rp2/p1nQ2p1/2p5/2P1P3/2K2P1B/PP6/R7 w - -
+5r1k/1p2rp2/p1nQ2p1/2p5/2P1P3/2K2P1B/PP6/7R b - -
+3r3k/1p2rp2/p1nQ2p1/2p5/2P1P3/2K2P1B/PP6/7R w - -
+3r3k/1p2rp2/p1n3p1/2Q5/2P1P3/2K2P1B/PP6/7R b - -
+3r3k/1p2rp2/2n3p1/p1Q5/2P1P3/2K2P1B/PP6/7R w - -
+3r3k/1p1Brp2/2n3p1/p1Q5/2P1P3/2K2P2/PP6/7R b - -
+3r4/1p1Brpk1/2n3p1/p1Q5/2P1P3/2K2P2/PP6/7R w - -
+3r4/1p2rpk1/2B3p1/p1Q5/2P1P3/2K2P2/PP6/7R b - -
+3r4/1pr2pk1/2B3p1/p1Q5/2P1P3/2K2P2/PP6/7R w - -
+3r4/1pr2pk1/2B3p1/p3Q3/2P1P3/2K2P2/PP6/7R b - -
+3r4/1pr3k1/2B2pp1/p3Q3/2P1P3/2K2P2/PP6/7R w - -
+3r4/1pQ3k1/2B2pp1/p7/2P1P3/2K2P2/PP6/7R b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/3P4/8/PPP1PPPP/RNBQKBNR b KQkq d3
+rnbqkbnr/pppp1ppp/8/4p3/3P4/8/PPP1PPPP/RNBQKBNR w KQkq e6
+rnbqkbnr/pppp1ppp/8/4P3/8/8/PPP1PPPP/RNBQKBNR b KQkq -
+rnbqkbnr/ppp2ppp/3p4/4P3/8/8/PPP1PPPP/RNBQKBNR w KQkq -
+rnbqkbnr/ppp2ppp/3P4/8/8/8/PPP1PPPP/RNBQKBNR b KQkq -
+rnbqk1nr/ppp2ppp/3b4/8/8/8/PPP1PPPP/RNBQKBNR w KQkq -
+rnbqk1nr/ppp2ppp/3b4/8/8/5N2/PPP1PPPP/RNBQKB1R b KQkq -
+rnbqk2r/ppp2ppp/3b1n2/8/8/5N2/PPP1PPPP/RNBQKB1R w KQkq -
+rnbqk2r/ppp2ppp/3b1n2/8/8/2N2N2/PPP1PPPP/R1BQKB1R b KQkq -
+rnbq1rk1/ppp2ppp/3b1n2/8/8/2N2N2/PPP1PPPP/R1BQKB1R w KQ -
+rnbq1rk1/ppp2ppp/3b1n2/8/8/P1N2N2/1PP1PPPP/R1BQKB1R b KQ -
+r1bq1rk1/ppp2ppp/2nb1n2/8/8/P1N2N2/1PP1PPPP/R1BQKB1R w KQ -
+r1bq1rk1/ppp2ppp/2nb1n2/8/8/P1N1PN2/1PP2PPP/R1BQKB1R b KQ -
+r1bq1rk1/1pp2ppp/p1nb1n2/8/8/P1N1PN2/1PP2PPP/R1BQKB1R w KQ -
+r1bq1rk1/1pp2ppp/p1nb1n2/8/8/P1N1PN2/1PP1BPPP/R1BQK2R b KQ -
+r1bq1rk1/1pp2pp1/p1nb1n1p/8/8/P1N1PN2/1PP1BPPP/R1BQK2R w KQ -
+r1bq1rk1/1pp2pp1/p1nb1n1p/8/8/P1N1PN2/1PP1BPPP/R1BQ1RK1 b - -
+r1bq1rk1/1pp2pp1/p2b1n1p/4n3/8/P1N1PN2/1PP1BPPP/R1BQ1RK1 w - -
+r1bq1rk1/1pp2pp1/p2b1n1p/4n3/8/P1N1PN2/1PPBBPPP/R2Q1RK1 b - -
+r1bq1rk1/1pp2pp1/p2b1n1p/8/8/P1N1Pn2/1PPBBPPP/R2Q1RK1 w - -
+r1bq1rk1/1pp2pp1/p2b1n1p/8/8/P1N1PB2/1PPB1PPP/R2Q1RK1 b - -
+r1bq1rk1/1pp2pp1/p4n1p/4b3/8/P1N1PB2/1PPB1PPP/R2Q1RK1 w - -
+r1bq1rk1/1pp2pp1/p4n1p/4b3/8/P1N1PB2/1PPB1PPP/2RQ1RK1 b - -
+r1bq1rk1/1p3pp1/p1p2n1p/4b3/8/P1N1PB2/1PPB1PPP/2RQ1RK1 w - -
+r1bq1rk1/1p3pp1/p1p2n1p/4b3/8/P1N1PB2/1PPBQPPP/2R2RK1 b - -
+r1b2rk1/1p3pp1/p1pq1n1p/4b3/8/P1N1PB2/1PPBQPPP/2R2RK1 w - -
+r1b2rk1/1p3pp1/p1pq1n1p/4b3/8/P1N1PB2/1PPBQPPP/2RR2K1 b - -
+r1b2rk1/1p3pp1/p1pq1n1p/8/8/P1N1PB2/1PPBQPPb/2RR2K1 w - -
+r1b2rk1/1p3pp1/p1pq1n1p/8/8/P1N1PB2/1PPBQPPb/2RR3K b - -
+r1b2rk1/1p3pp1/p1pq1n1p/4b3/8/P1N1PB2/1PPBQPP1/2RR3K w - -
+r1b2rk1/1p3pp1/p1pq1n1p/4b3/4P3/P1N2B2/1PPBQPP1/2RR3K b - -
+r1b2rk1/1p3pp1/p1pq1n1p/8/4P3/P1b2B2/1PPBQPP1/2RR3K w - -
+r1b2rk1/1p3pp1/p1pq1n1p/8/4P3/P1B2B2/1PP1QPP1/2RR3K b - -
+r1b2rk1/1p3pp1/p1p1qn1p/8/4P3/P1B2B2/1PP1QPP1/2RR3K w - -
+r1b2rk1/1p3pp1/p1p1qn1p/8/4P3/P1BR1B2/1PP1QPP1/2R4K b - -
+r4rk1/1p1b1pp1/p1p1qn1p/8/4P3/P1BR1B2/1PP1QPP1/2R4K w - -
+r4rk1/1p1b1pp1/p1p1qn1p/8/4P3/P1BR1B2/1PP1QPP1/3R3K b - -
+3r1rk1/1p1b1pp1/p1p1qn1p/8/4P3/P1BR1B2/1PP1QPP1/3R3K w - -
+3r1rk1/1p1b1pp1/p1p1qB1p/8/4P3/P2R1B2/1PP1QPP1/3R3K b - -
+3r1rk1/1p1b1p2/p1p1qp1p/8/4P3/P2R1B2/1PP1QPP1/3R3K w - -
+3r1rk1/1p1b1p2/p1pRqp1p/8/4P3/P4B2/1PP1QPP1/3R3K b - -
+3r1rk1/1p1bqp2/p1pR1p1p/8/4P3/P4B2/1PP1QPP1/3R3K w - -
+3r1rk1/1p1bqp2/p1pR1p1p/8/4P3/P4B2/1PPRQPP1/7K b - -
+3r1rk1/1p2qp2/p1pRbp1p/8/4P3/P4B2/1PPRQPP1/7K w - -
+3R1rk1/1p2qp2/p1p1bp1p/8/4P3/P4B2/1PPRQPP1/7K b - -
+3r2k1/1p2qp2/p1p1bp1p/8/4P3/P4B2/1PPRQPP1/7K w - -
+3R2k1/1p2qp2/p1p1bp1p/8/4P3/P4B2/1PP1QPP1/7K b - -
+3q2k1/1p3p2/p1p1bp1p/8/4P3/P4B2/1PP1QPP1/7K w - -
+3q2k1/1p3p2/p1p1bp1p/8/2P1P3/P4B2/1P2QPP1/7K b - c3
+6k1/1p3p2/p1p1bp1p/8/2PqP3/P4B2/1P2QPP1/7K w - -
+6k1/1p3p2/p1p1bp1p/2P5/3qP3/P4B2/1P2QPP1/7K b - -
+6k1/1p3p2/p1p1bp1p/2q5/4P3/P4B2/1P2QPP1/7K w - -
+6k1/1p3p2/p1p1bp1p/2q5/4P3/P4B2/1P1Q1PP1/7K b - -
+6k1/1p3p2/p1p1b2p/2q2p2/4P3/P4B2/1P1Q1PP1/7K w - -
+6k1/1p3p2/p1p1b2p/2q2P2/8/P4B2/1P1Q1PP1/7K b - -
+6k1/1p3p2/p1p4p/2q2b2/8/P4B2/1P1Q1PP1/7K w - -
+6k1/1p3p2/p1p4Q/2q2b2/8/P4B2/1P3PP1/7K b - -
+6k1/1p3p2/p1p3bQ/2q5/8/P4B2/1P3PP1/7K w - -
+6k1/1p3p2/p1p3bQ/2q5/4B3/P7/1P3PP1/7K b - -
+6k1/1p3p2/p1p4Q/2q5/4b3/P7/1P3PP1/7K w - -
+6k1/1p3p2/p1p5/2q5/4b2Q/P7/1P3PP1/7K b - -
+6k1/1p3p2/p1p3b1/2q5/7Q/P7/1P3PP1/7K w - -
+3Q2k1/1p3p2/p1p3b1/2q5/8/P7/1P3PP1/7K b - -
+3Q4/1p3pk1/p1p3b1/2q5/8/P7/1P3PP1/7K w - -
+8/1pQ2pk1/p1p3b1/2q5/8/P7/1P3PP1/7K b - -
+8/2Q2pk1/p1p3b1/1pq5/8/P7/1P3PP1/7K w - b6
+8/2Q2pk1/p1p3b1/1pq5/1P6/P7/5PP1/7K b - b3
+8/2Q2pk1/p1p3b1/1p6/1P6/P7/5PP1/2q4K w - -
+8/2Q2pk1/p1p3b1/1p6/1P6/P7/5PPK/2q5 b - -
+8/2Q2pk1/p1p3b1/1p6/1P6/q7/5PPK/8 w - -
+8/5pk1/p1p3b1/1p2Q3/1P6/q7/5PPK/8 b - -
+6k1/5p2/p1p3b1/1p2Q3/1P6/q7/5PPK/8 w - -
+4Q1k1/5p2/p1p3b1/1p6/1P6/q7/5PPK/8 b - -
+4Q3/5pk1/p1p3b1/1p6/1P6/q7/5PPK/8 w - -
+8/5pk1/p1Q3b1/1p6/1P6/q7/5PPK/8 b - -
+8/5pk1/p1Q3b1/1p6/1q6/8/5PPK/8 w - -
+8/5pk1/Q5b1/1p6/1q6/8/5PPK/8 b - -
+8/5pk1/Q5b1/1p6/7q/8/5PPK/8 w - -
+8/5pk1/Q5b1/1p6/7q/8/5PP1/6K1 b - -
+8/5pk1/Q5b1/8/1p5q/8/5PP1/6K1 w - -
+8/5pk1/6b1/8/1p5q/8/5PP1/Q5K1 b - -
+8/5pk1/5qb1/8/1p6/8/5PP1/Q5K1 w - -
+8/5pk1/5qb1/8/Qp6/8/5PP1/6K1 b - -
+8/5pk1/6b1/8/Qp6/2q5/5PP1/6K1 w - -
+8/5pk1/6b1/8/Qp6/2q2P2/6P1/6K1 b - -
+8/5pk1/6b1/8/Q7/1pq2P2/6P1/6K1 w - -
+8/5pk1/6b1/8/8/Qpq2P2/6P1/6K1 b - -
+8/5pk1/6b1/8/8/Qp3P2/2q3P1/6K1 w - -
+8/5pk1/6b1/8/8/Qp3P2/2q3PK/8 b - -
+8/5pk1/6b1/8/8/Q4P2/1pq3PK/8 w - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppppp1p/6p1/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppp1p/6p1/8/3PP3/8/PPP2PPP/RNBQKBNR b KQkq d3
+rnbqkbnr/ppp1pp1p/3p2p1/8/3PP3/8/PPP2PPP/RNBQKBNR w KQkq -
+rnbqkbnr/ppp1pp1p/3p2p1/8/3PP3/5N2/PPP2PPP/RNBQKB1R b KQkq -
+rnbqkbnr/pp2pp1p/2pp2p1/8/3PP3/5N2/PPP2PPP/RNBQKB1R w KQkq -
+rnbqkbnr/pp2pp1p/2pp2p1/8/3PP3/5N1P/PPP2PP1/RNBQKB1R b KQkq -
+rnbqkb1r/pp2pp1p/2pp1np1/8/3PP3/5N1P/PPP2PP1/RNBQKB1R w KQkq -
+rnbqkb1r/pp2pp1p/2pp1np1/6B1/3PP3/5N1P/PPP2PP1/RN1QKB1R b KQkq -
+rnbqkb1r/pp2pp1p/2pp2p1/6B1/3Pn3/5N1P/PPP2PP1/RN1QKB1R w KQkq -
+rnbqkb1r/pp2pp1p/2pp2p1/6B1/3Pn3/5N1P/PPP1QPP1/RN2KB1R b KQkq -
+rn1qkb1r/pp2pp1p/2pp2p1/5bB1/3Pn3/5N1P/PPP1QPP1/RN2KB1R w KQkq -
+rn1qkb1r/pp2pp1p/2pp2p1/5bB1/3Pn3/5N1P/PPPNQPP1/R3KB1R b KQkq -
+rn2kb1r/pp2pp1p/2pp2p1/q4bB1/3Pn3/5N1P/PPPNQPP1/R3KB1R w KQkq -
+rn2kb1r/pp2pp1p/2pp2p1/q4bB1/3Pn3/2P2N1P/PP1NQPP1/R3KB1R b KQkq -
+rn2kb1r/pp2pp1p/2pp2p1/q4bB1/3P4/2P2N1P/PP1nQPP1/R3KB1R w KQkq -
+rn2kb1r/pp2pp1p/2pp2p1/q4b2/3P4/2P2N1P/PP1BQPP1/R3KB1R b KQkq -
+r3kb1r/pp1npp1p/2pp2p1/q4b2/3P4/2P2N1P/PP1BQPP1/R3KB1R w KQkq -
+r3kb1r/pp1npp1p/2pp2p1/q4b2/1P1P4/2P2N1P/P2BQPP1/R3KB1R b KQkq b3
+r3kb1r/pp1npp1p/2pp2p1/5b2/1P1P4/q1P2N1P/P2BQPP1/R3KB1R w KQkq -
+r3kb1r/pp1npp1p/2pp2p1/5bN1/1P1P4/q1P4P/P2BQPP1/R3KB1R b KQkq -
+r3kb1r/pp1npp2/2pp2p1/5bNp/1P1P4/q1P4P/P2BQPP1/R3KB1R w KQkq h6
+r3kb1r/pp1npp2/2pp2p1/5bNp/1PQP4/q1P4P/P2B1PP1/R3KB1R b KQkq -
+r3kb1r/pp1npp2/2p3p1/3p1bNp/1PQP4/q1P4P/P2B1PP1/R3KB1R w KQkq -
+r3kb1r/pp1npp2/2p3p1/3p1bNp/1P1P4/q1P4P/P2BQPP1/R3KB1R b KQkq -
+r3kb1r/pp1npp2/2p3p1/3p1bNp/1P1P4/2P4P/Pq1BQPP1/R3KB1R w KQkq -
+r3kb1r/pp1npp2/2p3p1/3p1bNp/1P1P4/2P4P/Pq1B1PP1/R2QKB1R b KQkq -
+r3kb1r/pp1npp2/2p3p1/3p2Np/1P1P4/2P4P/PqbB1PP1/R2QKB1R w KQkq -
+r3kb1r/pp1npp2/2p3p1/3p2Np/1P1P4/2P4P/PqbB1PP1/R1Q1KB1R b KQkq -
+r3kb1r/pp1npp2/2p3p1/3p2Np/1P1P4/2P4P/P1bB1PP1/R1q1KB1R w KQkq -
+r3kb1r/pp1npp2/2p3p1/3p2Np/1P1P4/2P4P/P1bB1PP1/2R1KB1R b Kkq -
+r3kb1r/pp1npp2/2p3p1/3p2Np/bP1P4/2P4P/P2B1PP1/2R1KB1R w Kkq -
+r3kb1r/pp1npp2/2p3p1/3p2Np/bP1P4/2PB3P/P2B1PP1/2R1K2R b Kkq -
+r3kb1r/pp2pp2/1np3p1/3p2Np/bP1P4/2PB3P/P2B1PP1/2R1K2R w Kkq -
+r3kb1r/pp2pp2/1np3p1/3p2Np/bP1P4/2PB3P/P2B1PP1/2R2RK1 b kq -
+r3kb1r/pp2pp2/2p3p1/3p2Np/bPnP4/2PB3P/P2B1PP1/2R2RK1 w kq -
+r3kb1r/pp2pp2/2p3p1/3p2Np/bPBP4/2P4P/P2B1PP1/2R2RK1 b kq -
+r3kb1r/pp2pp2/2p3p1/6Np/bPpP4/2P4P/P2B1PP1/2R2RK1 w kq -
+r3kb1r/pp2pp2/2p3p1/6Np/bPpP1B2/2P4P/P4PP1/2R2RK1 b kq -
+r3k2r/pp2pp2/2p3pb/6Np/bPpP1B2/2P4P/P4PP1/2R2RK1 w kq -
+r3k2r/pp2pp2/2p3pb/6Np/bPpP1B2/2P4P/P4PP1/2R1R1K1 b kq -
+r4rk1/pp2pp2/2p3pb/6Np/bPpP1B2/2P4P/P4PP1/2R1R1K1 w - -
+r4rk1/pp2Rp2/2p3pb/6Np/bPpP1B2/2P4P/P4PP1/2R3K1 b - -
+4rrk1/pp2Rp2/2p3pb/6Np/bPpP1B2/2P4P/P4PP1/2R3K1 w - -
+4rrk1/pR3p2/2p3pb/6Np/bPpP1B2/2P4P/P4PP1/2R3K1 b - -
+4rrk1/pR6/2p2ppb/6Np/bPpP1B2/2P4P/P4PP1/2R3K1 w - -
+4rrk1/pR6/2p1Nppb/7p/bPpP1B2/2P4P/P4PP1/2R3K1 b - -
+5rk1/pR6/2p1rppb/7p/bPpP1B2/2P4P/P4PP1/2R3K1 w - -
+5rk1/pR6/2p1rppB/7p/bPpP4/2P4P/P4PP1/2R3K1 b - -
+6k1/pR3r2/2p1rppB/7p/bPpP4/2P4P/P4PP1/2R3K1 w - -
+1R4k1/p4r2/2p1rppB/7p/bPpP4/2P4P/P4PP1/2R3K1 b - -
+1R6/p4r1k/2p1rppB/7p/bPpP4/2P4P/P4PP1/2R3K1 w - -
+1R6/p4r1k/2p1rpp1/7p/bPpP1B2/2P4P/P4PP1/2R3K1 b - -
+1R6/p4r1k/2p1rp2/6pp/bPpP1B2/2P4P/P4PP1/2R3K1 w - -
+1R6/p4r1k/2p1rp2/6pp/bPpP4/2P4P/P2B1PP1/2R3K1 b - -
+1R6/p4r1k/2p2p2/6pp/bPpP4/2P4P/P2BrPP1/2R3K1 w - -
+1R6/p4r1k/2p2p2/6pp/bPpP4/2P4P/P3rPP1/2R1B1K1 b - -
+1R6/p3r2k/2p2p2/6pp/bPpP4/2P4P/P3rPP1/2R1B1K1 w - -
+1R6/p3r2k/2p2p2/6pp/bPpP4/2P4P/P3rPP1/2R1BK2 b - -
+1R6/p3r2k/2p2p2/6pp/1PpP4/2P4P/P1b1rPP1/2R1BK2 w - -
+2R5/p3r2k/2p2p2/6pp/1PpP4/2P4P/P1b1rPP1/2R1BK2 b - -
+2R5/p3r2k/2p2p2/6pp/1PpP4/2Pb3P/P3rPP1/2R1BK2 w - -
+8/p3r2k/2R2p2/6pp/1PpP4/2Pb3P/P3rPP1/2R1BK2 b - -
+8/p3r2k/2R2p2/6pp/1PpP4/2Pb3P/P1r2PP1/2R1BK2 w - -
+8/p3r2k/2R2p2/6pp/1PpP4/2Pb3P/P1r2PP1/2R1B1K1 b - -
+8/p3r2k/2R2p2/6pp/1PpP4/2Pb3P/P4PP1/2r1B1K1 w - -
+8/p3r2k/5R2/6pp/1PpP4/2Pb3P/P4PP1/2r1B1K1 b - -
+8/p3r2k/5R2/6p1/1PpP3p/2Pb3P/P4PP1/2r1B1K1 w - -
+8/p3r2k/5R2/6p1/1PpP2Pp/2Pb3P/P4P2/2r1B1K1 b - g3
+8/p6k/5R2/6p1/1PpP2Pp/2Pb3P/P4P2/2r1r1K1 w - -
+8/p6k/5R2/6p1/1PpP2Pp/2Pb3P/P4PK1/2r1r3 b - -
+8/p6k/5R2/6p1/1PpPb1Pp/2P4P/P4PK1/2r1r3 w - -
+8/p6k/5R2/6p1/1PpPb1Pp/2P2P1P/P5K1/2r1r3 b - -
+8/p6k/5R2/6p1/1PpPb1Pp/2P2P1P/P1r3K1/4r3 w - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppp1ppp/4p3/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppp1ppp/4p3/8/3PP3/8/PPP2PPP/RNBQKBNR b KQkq d3
+rnbqkbnr/ppp2ppp/4p3/3p4/3PP3/8/PPP2PPP/RNBQKBNR w KQkq d6
+rnbqkbnr/ppp2ppp/4p3/3p4/3PP3/2N5/PPP2PPP/R1BQKBNR b KQkq -
+rnbqkb1r/ppp2ppp/4pn2/3p4/3PP3/2N5/PPP2PPP/R1BQKBNR w KQkq -
+rnbqkb1r/ppp2ppp/4pn2/3p2B1/3PP3/2N5/PPP2PPP/R2QKBNR b KQkq -
+rnbqk2r/ppp1bppp/4pn2/3p2B1/3PP3/2N5/PPP2PPP/R2QKBNR w KQkq -
+rnbqk2r/ppp1bppp/4pB2/3p4/3PP3/2N5/PPP2PPP/R2QKBNR b KQkq -
+rnbqk2r/ppp2ppp/4pb2/3p4/3PP3/2N5/PPP2PPP/R2QKBNR w KQkq -
+rnbqk2r/ppp2ppp/4pb2/3pP3/3P4/2N5/PPP2PPP/R2QKBNR b KQkq -
+rnbqk2r/ppp1bppp/4p3/3pP3/3P4/2N5/PPP2PPP/R2QKBNR w KQkq -
+rnbqk2r/ppp1bppp/4p3/3pP3/3P2Q1/2N5/PPP2PPP/R3KBNR b KQkq -
+rnbq1rk1/ppp1bppp/4p3/3pP3/3P2Q1/2N5/PPP2PPP/R3KBNR w KQ -
+rnbq1rk1/ppp1bppp/4p3/3pP3/3P2Q1/2NB4/PPP2PPP/R3K1NR b KQ -
+rnbq1rk1/ppp1b1pp/4p3/3pPp2/3P2Q1/2NB4/PPP2PPP/R3K1NR w KQ f6
+rnbq1rk1/ppp1b1pp/4p3/3pPp2/3P4/2NB2Q1/PPP2PPP/R3K1NR b KQ -
+rnbq1rk1/pp2b1pp/4p3/2ppPp2/3P4/2NB2Q1/PPP2PPP/R3K1NR w KQ c6
+rnbq1rk1/pp2b1pp/4p3/2ppPp2/3P4/2NB1NQ1/PPP2PPP/R3K2R b KQ -
+rnb2rk1/pp2b1pp/1q2p3/2ppPp2/3P4/2NB1NQ1/PPP2PPP/R3K2R w KQ -
+rnb2rk1/pp2b1pp/1q2p3/2ppPp2/N2P4/3B1NQ1/PPP2PPP/R3K2R b KQ -
+rnb2rk1/pp2b1pp/4p3/2ppPp2/Nq1P4/3B1NQ1/PPP2PPP/R3K2R w KQ -
+rnb2rk1/pp2b1pp/4p3/2ppPp2/1q1P4/2NB1NQ1/PPP2PPP/R3K2R b KQ -
+rnb2rk1/pp2b1pp/4p3/2ppPp2/3P4/2NB1NQ1/PqP2PPP/R3K2R w KQ -
+rnb2rk1/pp2b1pp/4p3/2ppPp2/3P4/2NB1NQ1/PqPK1PPP/R6R b - -
+rnb2rk1/pp2b1pp/4p3/3pPp2/3p4/2NB1NQ1/PqPK1PPP/R6R w - -
+rnb2rk1/pp2b1pp/4p3/3pPp2/3N4/2NB2Q1/PqPK1PPP/R6R b - -
+rnb2rk1/pp4pp/4p3/3pPp2/1b1N4/2NB2Q1/PqPK1PPP/R6R w - -
+rnb2rk1/pp4pp/4p3/1B1pPp2/1b1N4/2N3Q1/PqPK1PPP/R6R b - -
+rnb2rk1/1p4pp/p3p3/1B1pPp2/1b1N4/2N3Q1/PqPK1PPP/R6R w - -
+rnb2rk1/1p4pp/p3p3/1B1pPp2/1b1N4/2N3Q1/PqPK1PPP/RR6 b - -
+rnb2rk1/1p4pp/p3p3/1B1pPp2/1b1N4/2q3Q1/P1PK1PPP/RR6 w - -
+rnb2rk1/1p4pp/p3p3/1B1pPp2/1b1N4/2Q5/P1PK1PPP/RR6 b - -
+rnb2rk1/1p4pp/p3p3/1B1pPp2/3N4/2b5/P1PK1PPP/RR6 w - -
+rnb2rk1/1p4pp/p3p3/1B1pPp2/3N4/2K5/P1P2PPP/RR6 b - -
+rnb2rk1/1p4pp/4p3/1p1pPp2/3N4/2K5/P1P2PPP/RR6 w - -
+rnb2rk1/1p4pp/4p3/1R1pPp2/3N4/2K5/P1P2PPP/R7 b - -
+r1b2rk1/1p4pp/2n1p3/1R1pPp2/3N4/2K5/P1P2PPP/R7 w - -
+r1b2rk1/1p4pp/2N1p3/1R1pPp2/8/2K5/P1P2PPP/R7 b - -
+r1b2rk1/6pp/2p1p3/1R1pPp2/8/2K5/P1P2PPP/R7 w - -
+r1b2rk1/6pp/2p1p3/2RpPp2/8/2K5/P1P2PPP/R7 b - -
+r4rk1/3b2pp/2p1p3/2RpPp2/8/2K5/P1P2PPP/R7 w - -
+r4rk1/3b2pp/2p1p3/2RpPp2/P7/2K5/2P2PPP/R7 b - a3
+5rk1/3b2pp/r1p1p3/2RpPp2/P7/2K5/2P2PPP/R7 w - -
+5rk1/3b2pp/r1p1p3/P1RpPp2/8/2K5/2P2PPP/R7 b - -
+r5k1/3b2pp/r1p1p3/P1RpPp2/8/2K5/2P2PPP/R7 w - -
+r5k1/3b2pp/r1p1p3/P1RpPp2/3K4/8/2P2PPP/R7 b - -
+r5k1/3b3p/r1p1p3/P1RpPpp1/3K4/8/2P2PPP/R7 w - g6
+r5k1/3b3p/r1p1p3/P1RpPpp1/R2K4/8/2P2PPP/8 b - -
+r5k1/3b4/r1p1p3/P1RpPppp/R2K4/8/2P2PPP/8 w - h6
+r5k1/3b4/r1p1p3/P1RpPppp/R2K4/7P/2P2PP1/8 b - -
+r5k1/3b4/r1p1p3/P1RpP1pp/R2K1p2/7P/2P2PP1/8 w - -
+r5k1/3b4/r1p1p3/P1RpP1pp/R2K1p2/5P1P/2P3P1/8 b - -
+r7/3b1k2/r1p1p3/P1RpP1pp/R2K1p2/5P1P/2P3P1/8 w - -
+r7/3b1k2/r1p1p3/P1RpP1pp/R4p2/3K1P1P/2P3P1/8 b - -
+r7/3bk3/r1p1p3/P1RpP1pp/R4p2/3K1P1P/2P3P1/8 w - -
+r7/3bk3/r1p1p3/P1RpP1pp/R4p2/5P1P/2P1K1P1/8 b - -
+r3b3/4k3/r1p1p3/P1RpP1pp/R4p2/5P1P/2P1K1P1/8 w - -
+r3b3/4k3/r1p1p3/P1RpP1pp/R4p2/5P1P/2P2KP1/8 b - -
+r3b3/3k4/r1p1p3/P1RpP1pp/R4p2/5P1P/2P2KP1/8 w - -
+r3b3/3k4/r1p1p3/P1RpP1pp/R4p2/5PPP/2P2K2/8 b - -
+r3b3/3k4/r1p1p3/P1RpP1pp/R7/5PpP/2P2K2/8 w - -
+r3b3/3k4/r1p1p3/P1RpP1pp/R7/5PKP/2P5/8 b - -
+r7/3k4/r1p1p1b1/P1RpP1pp/R7/5PKP/2P5/8 w - -
+r7/3k4/r1p1p1b1/P1RpP1pp/8/5PKP/R1P5/8 b - -
+r7/3k4/r1p1p3/P1RpPbpp/8/5PKP/R1P5/8 w - -
+r7/3k4/r1p1p3/P1RpPbpp/7P/5PK1/R1P5/8 b - -
+r7/3k4/r1p1p3/P1RpPb1p/6pP/5PK1/R1P5/8 w - -
+r7/3k4/r1p1p3/P1RpPb1p/6PP/6K1/R1P5/8 b - -
+r7/3k4/r1p1p3/P1RpP2p/6bP/6K1/R1P5/8 w - -
+r7/3k4/r1p1p3/P1RpP2p/5KbP/8/R1P5/8 b - -
+5r2/3k4/r1p1p3/P1RpP2p/5KbP/8/R1P5/8 w - -
+5r2/3k4/r1p1p3/P1RpP1Kp/6bP/8/R1P5/8 b - -
+8/3k4/r1p1p3/P1RpPrKp/6bP/8/R1P5/8 w - -
+8/3k4/r1p1p2K/P1RpPr1p/6bP/8/R1P5/8 b - -
+8/3k4/r1p1p2K/P1Rpr2p/6bP/8/R1P5/8 w - -
+8/3k4/r1p1p2K/P1Rpr2p/R5bP/8/2P5/8 b - -
+8/8/r1pkp2K/P1Rpr2p/R5bP/8/2P5/8 w - -
+8/8/r1pkp2K/P2pr2p/R5bP/2R5/2P5/8 b - -
+8/8/r2kp2K/P1ppr2p/R5bP/2R5/2P5/8 w - -
+8/8/r2kp2K/P1ppr2p/R5bP/6R1/2P5/8 b - -
+8/8/r2kp2K/P2pr2p/R1p3bP/6R1/2P5/8 w - -
+8/6K1/r2kp3/P2pr2p/R1p3bP/6R1/2P5/8 b - -
+8/6K1/r3p3/P1kpr2p/R1p3bP/6R1/2P5/8 w - -
+8/8/r3pK2/P1kpr2p/R1p3bP/6R1/2P5/8 b - -
+8/8/r3pK2/P1kp3p/R1p3bP/6R1/2P1r3/8 w - -
+8/4K3/r3p3/P1kp3p/R1p3bP/6R1/2P1r3/8 b - -
+8/4K3/r3p3/P1kp3p/R1p3bP/6R1/2r5/8 w - -
+8/4K3/r3p3/P1kp3p/R1p3RP/8/2r5/8 b - -
+8/4K3/r3p3/P1kp4/R1p3pP/8/2r5/8 w - -
+8/4K3/r3p3/P1kp3P/R1p3p1/8/2r5/8 b - -
+8/4K3/r3p3/P1kp3P/R1p3p1/8/7r/8 w - -
+8/4K3/r3p3/P1kp3P/2p3p1/R7/7r/8 b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppp1ppp/8/4p3/4P3/8/PPPP1PPP/RNBQKBNR w KQkq e6
+rnbqkbnr/pppp1ppp/8/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R b KQkq -
+r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq -
+r1bqkbnr/pppp1ppp/2n5/4p3/2B1P3/5N2/PPPP1PPP/RNBQK2R b KQkq -
+r1bqk1nr/pppp1ppp/2n5/2b1p3/2B1P3/5N2/PPPP1PPP/RNBQK2R w KQkq -
+r1bqk1nr/pppp1ppp/2n5/2b1p3/2B1P3/P4N2/1PPP1PPP/RNBQK2R b KQkq -
+r1b1k1nr/pppp1ppp/2n2q2/2b1p3/2B1P3/P4N2/1PPP1PPP/RNBQK2R w KQkq -
+r1b1k1nr/pppp1ppp/2n2q2/2b1p3/1PB1P3/P4N2/2PP1PPP/RNBQK2R b KQkq b3
+r1b1k1nr/pppp1ppp/1bn2q2/4p3/1PB1P3/P4N2/2PP1PPP/RNBQK2R w KQkq -
+r1b1k1nr/pppp1ppp/1bn2q2/4p3/1PB1P3/P2P1N2/2P2PPP/RNBQK2R b KQkq -
+r1b1k1nr/pppp1pp1/1bn2q1p/4p3/1PB1P3/P2P1N2/2P2PPP/RNBQK2R w KQkq -
+r1b1k1nr/pppp1pp1/1bn2q1p/4p3/1PB1P3/P1NP1N2/2P2PPP/R1BQK2R b KQkq -
+r1b1k2r/ppppnpp1/1bn2q1p/4p3/1PB1P3/P1NP1N2/2P2PPP/R1BQK2R w KQkq -
+r1b1k2r/ppppnpp1/1bn2q1p/4p3/1PB1P3/P1NP1N2/2P2PPP/R1BQ1RK1 b kq -
+r1b2rk1/ppppnpp1/1bn2q1p/4p3/1PB1P3/P1NP1N2/2P2PPP/R1BQ1RK1 w - -
+r1b2rk1/ppppnpp1/1bn2q1p/4p3/1PB1P3/P1NP1N2/2P2PPP/R1BQR1K1 b - -
+r1b2rk1/1pppnpp1/pbn2q1p/4p3/1PB1P3/P1NP1N2/2P2PPP/R1BQR1K1 w - -
+r1b2rk1/1pppnpp1/pbn2q1p/4p3/1PB1P3/P1NPBN2/2P2PPP/R2QR1K1 b - -
+r1b2rk1/1pppnpp1/pb3q1p/4p3/1PBnP3/P1NPBN2/2P2PPP/R2QR1K1 w - -
+r1b2rk1/1pppnpp1/pb3q1p/4p3/1PBBP3/P1NP1N2/2P2PPP/R2QR1K1 b - -
+r1b2rk1/1pppnpp1/pb3q1p/8/1PBpP3/P1NP1N2/2P2PPP/R2QR1K1 w - -
+r1b2rk1/1pppnpp1/pb3q1p/4P3/1PBp4/P1NP1N2/2P2PPP/R2QR1K1 b - -
+r1b2rk1/1pppnpp1/pb4qp/4P3/1PBp4/P1NP1N2/2P2PPP/R2QR1K1 w - -
+r1b2rk1/1pppnpp1/pb4qp/4P3/1PBpN3/P2P1N2/2P2PPP/R2QR1K1 b - -
+r1b2rk1/1pp1npp1/pb4qp/3pP3/1PBpN3/P2P1N2/2P2PPP/R2QR1K1 w - d6
+r1b2rk1/1pp1npp1/pb1P2qp/8/1PBpN3/P2P1N2/2P2PPP/R2QR1K1 b - -
+r1b2rk1/1p2npp1/pb1p2qp/8/1PBpN3/P2P1N2/2P2PPP/R2QR1K1 w - -
+r1b2rk1/1p2npp1/pb1p2qp/8/1P1pN3/PB1P1N2/2P2PPP/R2QR1K1 b - -
+r4rk1/1p2npp1/pb1pb1qp/8/1P1pN3/PB1P1N2/2P2PPP/R2QR1K1 w - -
+r4rk1/1p2npp1/pb1pB1qp/8/1P1pN3/P2P1N2/2P2PPP/R2QR1K1 b - -
+r4rk1/1p2n1p1/pb1pp1qp/8/1P1pN3/P2P1N2/2P2PPP/R2QR1K1 w - -
+r4rk1/1p2n1p1/pb1Np1qp/8/1P1p4/P2P1N2/2P2PPP/R2QR1K1 b - -
+1r3rk1/1p2n1p1/pb1Np1qp/8/1P1p4/P2P1N2/2P2PPP/R2QR1K1 w - -
+1r3rk1/1p2n1p1/pb2p1qp/8/1PNp4/P2P1N2/2P2PPP/R2QR1K1 b - -
+1r3rk1/bp2n1p1/p3p1qp/8/1PNp4/P2P1N2/2P2PPP/R2QR1K1 w - -
+1r3rk1/bp2n1p1/p3p1qp/4N3/1PNp4/P2P4/2P2PPP/R2QR1K1 b - -
+1r2qrk1/bp2n1p1/p3p2p/4N3/1PNp4/P2P4/2P2PPP/R2QR1K1 w - -
+1r2qrk1/bp2n1p1/p2Np2p/4N3/1P1p4/P2P4/2P2PPP/R2QR1K1 b - -
+1r1q1rk1/bp2n1p1/p2Np2p/4N3/1P1p4/P2P4/2P2PPP/R2QR1K1 w - -
+1r1q1rk1/bp2n1p1/p3p2p/4N3/1PNp4/P2P4/2P2PPP/R2QR1K1 b - -
+1r3rk1/bp2n1p1/p3p2p/3qN3/1PNp4/P2P4/2P2PPP/R2QR1K1 w - -
+1r3rk1/bp2n1p1/p3p2p/3qN3/1PNp2Q1/P2P4/2P2PPP/R3R1K1 b - -
+1r4k1/bp2n1p1/p3p2p/3qNr2/1PNp2Q1/P2P4/2P2PPP/R3R1K1 w - -
+1r4k1/bp2n1p1/p3p1Np/3q1r2/1PNp2Q1/P2P4/2P2PPP/R3R1K1 b - -
+1r4k1/bp4p1/p3p1np/3q1r2/1PNp2Q1/P2P4/2P2PPP/R3R1K1 w - -
+1r4k1/bp4p1/p3p1Qp/3q1r2/1PNp4/P2P4/2P2PPP/R3R1K1 b - -
+4r1k1/bp4p1/p3p1Qp/3q1r2/1PNp4/P2P4/2P2PPP/R3R1K1 w - -
+4Q1k1/bp4p1/p3p2p/3q1r2/1PNp4/P2P4/2P2PPP/R3R1K1 b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppp1ppp/8/4p3/4P3/8/PPPP1PPP/RNBQKBNR w KQkq e6
+rnbqkbnr/pppp1ppp/8/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R b KQkq -
+r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq -
+r1bqkbnr/pppp1ppp/2n5/1B2p3/4P3/5N2/PPPP1PPP/RNBQK2R b KQkq -
+r1bqkb1r/ppppnppp/2n5/1B2p3/4P3/5N2/PPPP1PPP/RNBQK2R w KQkq -
+r1bqkb1r/ppppnppp/2n5/1B2p3/4P3/2N2N2/PPPP1PPP/R1BQK2R b KQkq -
+r1bqkb1r/ppppnpp1/2n4p/1B2p3/4P3/2N2N2/PPPP1PPP/R1BQK2R w KQkq -
+r1bqkb1r/ppppnpp1/2n4p/1B1Np3/4P3/5N2/PPPP1PPP/R1BQK2R b KQkq -
+r1bqkb1r/1pppnpp1/p1n4p/1B1Np3/4P3/5N2/PPPP1PPP/R1BQK2R w KQkq -
+r1bqkb1r/1pppnpp1/p1n4p/3Np3/B3P3/5N2/PPPP1PPP/R1BQK2R b KQkq -
+r1bqkb1r/2ppnpp1/p1n4p/1p1Np3/B3P3/5N2/PPPP1PPP/R1BQK2R w KQkq b6
+r1bqkb1r/2ppnpp1/p1n4p/1p1Np3/4P3/1B3N2/PPPP1PPP/R1BQK2R b KQkq -
+r1bqkb1r/2pp1pp1/p1n3np/1p1Np3/4P3/1B3N2/PPPP1PPP/R1BQK2R w KQkq -
+r1bqkb1r/2pp1pp1/p1n3np/1p1Np3/2P1P3/1B3N2/PP1P1PPP/R1BQK2R b KQkq c3
+r1bqkb1r/2pp1pp1/p1n3np/3Np3/1pP1P3/1B3N2/PP1P1PPP/R1BQK2R w KQkq -
+r1bqkb1r/2pp1pp1/p1n3np/3Np3/BpP1P3/5N2/PP1P1PPP/R1BQK2R b KQkq -
+r1bqkb1r/2pp1pp1/p5np/3Np3/BpPnP3/5N2/PP1P1PPP/R1BQK2R w KQkq -
+r1bqkb1r/2pp1pp1/p5np/3Np3/BpPnP3/5N2/PP1P1PPP/R1BQ1RK1 b kq -
+r1bqkb1r/3p1pp1/p1p3np/3Np3/BpPnP3/5N2/PP1P1PPP/R1BQ1RK1 w kq -
+r1bqkb1r/3p1pp1/p1p3np/4p3/BpPnP3/4NN2/PP1P1PPP/R1BQ1RK1 b kq -
+r1bqkb1r/3p1pp1/2p3np/p3p3/BpPnP3/4NN2/PP1P1PPP/R1BQ1RK1 w kq -
+r1bqkb1r/3p1pp1/2p3np/p3p3/BpPNP3/4N3/PP1P1PPP/R1BQ1RK1 b kq -
+r1bqkb1r/3p1pp1/2p3np/p7/BpPpP3/4N3/PP1P1PPP/R1BQ1RK1 w kq -
+r1bqkb1r/3p1pp1/2p3np/p4N2/BpPpP3/8/PP1P1PPP/R1BQ1RK1 b kq -
+r2qkb1r/3p1pp1/b1p3np/p4N2/BpPpP3/8/PP1P1PPP/R1BQ1RK1 w kq -
+r2qkb1r/3p1pp1/b1p3np/p7/BpPNP3/8/PP1P1PPP/R1BQ1RK1 b kq -
+r2qkb1r/3p1pp1/2p3np/p7/BpbNP3/8/PP1P1PPP/R1BQ1RK1 w kq -
+r2qkb1r/3p1pp1/2N3np/p7/Bpb1P3/8/PP1P1PPP/R1BQ1RK1 b kq -
+r2qkb1r/3p1pp1/2N3np/p7/Bp2P3/8/PP1P1PPP/R1BQ1bK1 w kq -
+r2Nkb1r/3p1pp1/6np/p7/Bp2P3/8/PP1P1PPP/R1BQ1bK1 b kq -
+r2Nkb1r/3p1pp1/6np/p7/Bp2P3/8/PP1P1PbP/R1BQ2K1 w kq -
+r3kb1r/3p1Np1/6np/p7/Bp2P3/8/PP1P1PbP/R1BQ2K1 b kq -
+r3kb1r/3p1Np1/6np/p7/Bp2b3/8/PP1P1P1P/R1BQ2K1 w kq -
+r3kb1r/3p1Np1/6np/p7/Bp2b3/8/PP1PQP1P/R1B3K1 b kq -
+r4b1r/3p1kp1/6np/p7/Bp2b3/8/PP1PQP1P/R1B3K1 w - -
+r4b1r/3p1kp1/6np/p7/Bp2Q3/8/PP1P1P1P/R1B3K1 b - -
+r4bkr/3p2p1/6np/p7/Bp2Q3/8/PP1P1P1P/R1B3K1 w - -
+Q4bkr/3p2p1/6np/p7/Bp6/8/PP1P1P1P/R1B3K1 b - -
+Q4b1r/3p2pk/6np/p7/Bp6/8/PP1P1P1P/R1B3K1 w - -
+5b1r/3p2pk/6np/p7/Bp2Q3/8/PP1P1P1P/R1B3K1 b - -
+5b1r/6pk/6np/p2p4/Bp2Q3/8/PP1P1P1P/R1B3K1 w - d6
+5b1r/6pk/6np/p2Q4/Bp6/8/PP1P1P1P/R1B3K1 b - -
+7r/4b1pk/6np/p2Q4/Bp6/8/PP1P1P1P/R1B3K1 w - -
+7r/4b1pk/6np/p2Q4/Bp6/3P4/PP3P1P/R1B3K1 b - -
+5r2/4b1pk/6np/p2Q4/Bp6/3P4/PP3P1P/R1B3K1 w - -
+5r2/4b1pk/6np/p2Q4/1p6/1B1P4/PP3P1P/R1B3K1 b - -
+5r2/4b1pk/7p/p2Q4/1p3n2/1B1P4/PP3P1P/R1B3K1 w - -
+5r2/4b1pk/7p/p7/1p2Qn2/1B1P4/PP3P1P/R1B3K1 b - -
+5r2/4b1pk/6np/p7/1p2Q3/1B1P4/PP3P1P/R1B3K1 w - -
+5r2/4b1pk/6np/p7/1p2Q3/1B1PB3/PP3P1P/R5K1 b - -
+5r2/6pk/6np/p7/1p2Q2b/1B1PB3/PP3P1P/R5K1 w - -
+5r2/6pk/6np/p7/1p2Q2b/1B1PB3/PP3P1P/5RK1 b - -
+5r2/6pk/5bnp/p7/1p2Q3/1B1PB3/PP3P1P/5RK1 w - -
+5r2/6pk/5bnp/p7/1p1BQ3/1B1P4/PP3P1P/5RK1 b - -
+5r2/6pk/6np/p7/1p1BQ2b/1B1P4/PP3P1P/5RK1 w - -
+5r2/6pk/6np/p7/1p1BQP1b/1B1P4/PP5P/5RK1 b - f3
+3b1r2/6pk/6np/p7/1p1BQP2/1B1P4/PP5P/5RK1 w - -
+3b1r2/6pk/6np/p4P2/1p1BQ3/1B1P4/PP5P/5RK1 b - -
+3b1r2/4n1pk/7p/p4P2/1p1BQ3/1B1P4/PP5P/5RK1 w - -
+3b1r2/4n1pk/5P1p/p7/1p1BQ3/1B1P4/PP5P/5RK1 b - -
+3b1r2/6pk/5Pnp/p7/1p1BQ3/1B1P4/PP5P/5RK1 w - -
+3b1r2/6Pk/6np/p7/1p1BQ3/1B1P4/PP5P/5RK1 b - -
+3b4/6Pk/6np/p7/1p1BQ3/1B1P4/PP5P/5rK1 w - -
+3b4/6Pk/6np/p7/1p1BQ3/1B1P4/PP5P/5K2 b - -
+3b4/6Pk/6n1/p6p/1p1BQ3/1B1P4/PP5P/5K2 w - -
+3b2Q1/7k/6n1/p6p/1p1BQ3/1B1P4/PP5P/5K2 b - -
+3b2Q1/8/6nk/p6p/1p1BQ3/1B1P4/PP5P/5K2 w - -
+3b2Q1/8/6Qk/p6p/1p1B4/1B1P4/PP5P/5K2 b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pp1ppppp/8/2p5/4P3/8/PPPP1PPP/RNBQKBNR w KQkq c6
+rnbqkbnr/pp1ppppp/8/2p5/4PP2/8/PPPP2PP/RNBQKBNR b KQkq f3
+rnbqkbnr/pp2pppp/8/2pp4/4PP2/8/PPPP2PP/RNBQKBNR w KQkq d6
+rnbqkbnr/pp2pppp/8/2pP4/5P2/8/PPPP2PP/RNBQKBNR b KQkq -
+rnb1kbnr/pp2pppp/8/2pq4/5P2/8/PPPP2PP/RNBQKBNR w KQkq -
+rnb1kbnr/pp2pppp/8/2pq4/5P2/2N5/PPPP2PP/R1BQKBNR b KQkq -
+rnbqkbnr/pp2pppp/8/2p5/5P2/2N5/PPPP2PP/R1BQKBNR w KQkq -
+rnbqkbnr/pp2pppp/8/2p5/2B2P2/2N5/PPPP2PP/R1BQK1NR b KQkq -
+rn1qkbnr/pp2pppp/8/2p2b2/2B2P2/2N5/PPPP2PP/R1BQK1NR w KQkq -
+rn1qkbnr/pp2pppp/8/2p2b2/2B2P2/2NP4/PPP3PP/R1BQK1NR b KQkq -
+rn1qkbnr/1p2pppp/p7/2p2b2/2B2P2/2NP4/PPP3PP/R1BQK1NR w KQkq -
+rn1qkbnr/1p2pppp/p7/2p2b2/2B2PP1/2NP4/PPP4P/R1BQK1NR b KQkq g3
+rn1qkbnr/1p1bpppp/p7/2p5/2B2PP1/2NP4/PPP4P/R1BQK1NR w KQkq -
+rn1qkbnr/1p1bpppp/p7/2p5/P1B2PP1/2NP4/1PP4P/R1BQK1NR b KQkq a3
+rn1qkbnr/1p1b1ppp/p3p3/2p5/P1B2PP1/2NP4/1PP4P/R1BQK1NR w KQkq -
+rn1qkbnr/1p1b1ppp/p3p3/2p5/P1B2PP1/2NP4/1PPB3P/R2QK1NR b KQkq -
+rn1qkbnr/1p3ppp/p1b1p3/2p5/P1B2PP1/2NP4/1PPB3P/R2QK1NR w KQkq -
+rn1qkbnr/1p3ppp/p1b1p3/2p5/P1B2PP1/2NP1N2/1PPB3P/R2QK2R b KQkq -
+rn1qkbnr/1p3ppp/p3p3/2p5/P1B2PP1/2NP1b2/1PPB3P/R2QK2R w KQkq -
+rn1qkbnr/1p3ppp/p3p3/2p5/P1B2PP1/2NP1Q2/1PPB3P/R3K2R b KQkq -
+rn2kbnr/1p3ppp/p3p3/2p5/P1B2PPq/2NP1Q2/1PPB3P/R3K2R w KQkq -
+rn2kbnr/1p3ppp/p3p3/2p5/P1B2PPq/2NP2Q1/1PPB3P/R3K2R b KQkq -
+rn2kbnr/1p3ppp/p3p3/2p5/P1B2PP1/2NP2q1/1PPB3P/R3K2R w KQkq -
+rn2kbnr/1p3ppp/p3p3/2p5/P1B2PP1/2NP2P1/1PPB4/R3K2R b KQkq -
+r3kbnr/1p3ppp/p1n1p3/2p5/P1B2PP1/2NP2P1/1PPB4/R3K2R w KQkq -
+r3kbnr/1p3ppp/p1n1p3/2p5/P1B2PP1/2NP2P1/1PPB4/2KR3R b kq -
+2kr1bnr/1p3ppp/p1n1p3/2p5/P1B2PP1/2NP2P1/1PPB4/2KR3R w - -
+2kr1bnr/1p3ppp/p1n1p3/2p2P2/P1B3P1/2NP2P1/1PPB4/2KR3R b - -
+2kr1bnr/1p3ppp/p3p3/2p1nP2/P1B3P1/2NP2P1/1PPB4/2KR3R w - -
+2kr1bnr/1p3ppp/p3P3/2p1n3/P1B3P1/2NP2P1/1PPB4/2KR3R b - -
+2kr1bnr/1p3ppp/p3P3/2p5/P1n3P1/2NP2P1/1PPB4/2KR3R w - -
+2kr1bnr/1p3ppp/p3P3/2p5/P1P3P1/2N3P1/1PPB4/2KR3R b - -
+2kr1bnr/1p4pp/p3p3/2p5/P1P3P1/2N3P1/1PPB4/2KR3R w - -
+2kr1bnr/1p4pp/p3p3/2p5/P1P3P1/2N3P1/1PPB4/2K1R2R b - -
+2kr2nr/1p4pp/p2bp3/2p5/P1P3P1/2N3P1/1PPB4/2K1R2R w - -
+2kr2nr/1p4pp/p2bp3/2p5/P1P2BP1/2N3P1/1PP5/2K1R2R b - -
+2kr2nr/1p4pp/p3p3/2p5/P1P2bP1/2N3P1/1PP5/2K1R2R w - -
+2kr2nr/1p4pp/p3p3/2p5/P1P2PP1/2N5/1PP5/2K1R2R b - -
+2kr3r/1p4pp/p3p2n/2p5/P1P2PP1/2N5/1PP5/2K1R2R w - -
+2kr3r/1p4pp/p3p2n/2p3P1/P1P2P2/2N5/1PP5/2K1R2R b - -
+2kr3r/1p4pp/p3p3/2p2nP1/P1P2P2/2N5/1PP5/2K1R2R w - -
+2kr3r/1p4pp/p3R3/2p2nP1/P1P2P2/2N5/1PP5/2K4R b - -
+2k4r/1p4pp/p3R3/2p2nP1/P1Pr1P2/2N5/1PP5/2K4R w - -
+2k4r/1p4pp/p3R3/2p2nP1/P1Pr1P2/2N5/1PP5/2K2R2 b - -
+2k4r/1p4pp/p3R3/2p2nP1/P1r2P2/2N5/1PP5/2K2R2 w - -
+2k4r/1p4pp/p7/2p1RnP1/P1r2P2/2N5/1PP5/2K2R2 b - -
+2k4r/1p5p/p5p1/2p1RnP1/P1r2P2/2N5/1PP5/2K2R2 w - -
+2k4r/1p5p/p5p1/2p1RnP1/P1r2P2/2N5/1PPK4/5R2 b - -
+2kr4/1p5p/p5p1/2p1RnP1/P1r2P2/2N5/1PPK4/5R2 w - -
+2kr4/1p5p/p5p1/2p1RnP1/P1r2P2/2N5/1PP5/2K2R2 b - -
+2k5/1p1r3p/p5p1/2p1RnP1/P1r2P2/2N5/1PP5/2K2R2 w - -
+2k5/1p1r3p/p5p1/2pNRnP1/P1r2P2/8/1PP5/2K2R2 b - -
+2k5/1p5p/p2r2p1/2pNRnP1/P1r2P2/8/1PP5/2K2R2 w - -
+2k5/1p2N2p/p2r2p1/2p1RnP1/P1r2P2/8/1PP5/2K2R2 b - -
+2k5/1p2n2p/p2r2p1/2p1R1P1/P1r2P2/8/1PP5/2K2R2 w - -
+2k5/1p2R2p/p2r2p1/2p3P1/P1r2P2/8/1PP5/2K2R2 b - -
+2k5/1p1rR2p/p5p1/2p3P1/P1r2P2/8/1PP5/2K2R2 w - -
+2k5/1p1R3p/p5p1/2p3P1/P1r2P2/8/1PP5/2K2R2 b - -
+8/1p1k3p/p5p1/2p3P1/P1r2P2/8/1PP5/2K2R2 w - -
+8/1p1k3p/p5p1/2p3P1/P1r2P2/1P6/2P5/2K2R2 b - -
+8/1p1k3p/p5p1/2p3P1/P3rP2/1P6/2P5/2K2R2 w - -
+8/1p1k3p/p5p1/2p3P1/P3rP2/1P6/1KP5/5R2 b - -
+8/1p5p/p3k1p1/2p3P1/P3rP2/1P6/1KP5/5R2 w - -
+8/1p5p/p3k1p1/2p3P1/P3rP2/1PK5/2P5/5R2 b - -
+8/1p5p/p5p1/2p2kP1/P3rP2/1PK5/2P5/5R2 w - -
+8/1p5p/p5p1/2p2kP1/P3rP2/1PK5/2P5/7R b - -
+8/1p2r2p/p5p1/2p2kP1/P4P2/1PK5/2P5/7R w - -
+8/1p2r2p/p5p1/2p2kP1/P4P2/1PK5/2P5/5R2 b - -
+8/1p5p/p5p1/2p2kP1/P3rP2/1PK5/2P5/5R2 w - -
+8/1p5p/p5p1/2p2kP1/P3rP2/1PK5/2P5/7R b - -
+8/1p5p/p5p1/2p2kP1/P4r2/1PK5/2P5/7R w - -
+8/1p5R/p5p1/2p2kP1/P4r2/1PK5/2P5/8 b - -
+8/1p5R/p5p1/2p3k1/P4r2/1PK5/2P5/8 w - -
+8/1R6/p5p1/2p3k1/P4r2/1PK5/2P5/8 b - -
+8/1R6/p4rp1/2p3k1/P7/1PK5/2P5/8 w - -
+8/2R5/p4rp1/2p3k1/P7/1PK5/2P5/8 b - -
+8/2R5/p4rp1/2p5/P4k2/1PK5/2P5/8 w - -
+8/8/p4rp1/2R5/P4k2/1PK5/2P5/8 b - -
+8/8/p4r2/2R3p1/P4k2/1PK5/2P5/8 w - -
+8/8/p4r2/2R3p1/PP3k2/2K5/2P5/8 b - -
+8/8/p4r2/2R5/PP3kp1/2K5/2P5/8 w - -
+8/8/p4r2/8/PPR2kp1/2K5/2P5/8 b - -
+8/8/p4r2/8/PPR3p1/2K2k2/2P5/8 w - -
+8/8/p4r2/2R5/PP4p1/2K2k2/2P5/8 b - -
+8/8/p5r1/2R5/PP4p1/2K2k2/2P5/8 w - -
+8/8/p5r1/5R2/PP4p1/2K2k2/2P5/8 b - -
+8/8/p5r1/5R2/PP4p1/2K5/2P3k1/8 w - -
+8/8/p5r1/1P3R2/P5p1/2K5/2P3k1/8 b - -
+8/8/6r1/1p3R2/P5p1/2K5/2P3k1/8 w - -
+8/8/6r1/1P3R2/6p1/2K5/2P3k1/8 b - -
+8/8/6r1/1P3R2/8/2K3p1/2P3k1/8 w - -
+8/8/6r1/1P3R2/1K6/6p1/2P3k1/8 b - -
+8/8/6r1/1P3R2/1K6/6p1/2P5/7k w - -
+8/8/6r1/1P1R4/1K6/6p1/2P5/7k b - -
+8/8/6r1/1P1R4/1K6/8/2P3p1/7k w - -
+8/8/6r1/1P6/1K6/8/2P3p1/3R3k b - -
+8/8/6r1/1P6/1K6/8/2P5/3R2qk w - -
+8/8/6r1/1P6/1K6/8/2P5/6Rk b - -
+8/8/6r1/1P6/1K6/8/2P5/6k1 w - -
+8/8/6r1/1P6/1KP5/8/8/6k1 b - c3
+8/8/6r1/1P6/1KP5/8/5k2/8 w - -
+8/8/6r1/1PP5/1K6/8/5k2/8 b - -
+8/8/6r1/1PP5/1K6/4k3/8/8 w - -
+8/8/1P4r1/2P5/1K6/4k3/8/8 b - -
+8/8/1P4r1/2P5/1K1k4/8/8/8 w - -
+8/1P6/6r1/2P5/1K1k4/8/8/8 b - -
+8/1P6/8/2P5/1K1k4/8/8/6r1 w - -
+8/1P6/8/1KP5/3k4/8/8/6r1 b - -
+8/1P6/8/1KP5/3k4/8/8/1r6 w - -
+8/1P6/2K5/2P5/3k4/8/8/1r6 b - -
+8/1P6/2K5/2P5/1r1k4/8/8/8 w - -
+8/1PK5/8/2P5/1r1k4/8/8/8 b - -
+8/1PK5/8/2k5/1r6/8/8/8 w - -
+1Q6/2K5/8/2k5/1r6/8/8/8 b - -
+1r6/2K5/8/2k5/8/8/8/8 w - -
+1K6/8/8/2k5/8/8/8/8 b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/8/1P6/P1PPPPPP/RNBQKBNR b KQkq -
+rnbqkbnr/pppp1ppp/8/4p3/8/1P6/P1PPPPPP/RNBQKBNR w KQkq e6
+rnbqkbnr/pppp1ppp/8/4p3/8/1P6/PBPPPPPP/RN1QKBNR b KQkq -
+rnbqkbnr/pppp1ppp/8/8/4p3/1P6/PBPPPPPP/RN1QKBNR w KQkq -
+rnbqkbnr/pppp1ppp/8/8/4p3/1P1P4/PBP1PPPP/RN1QKBNR b KQkq -
+rnbqkb1r/pppp1ppp/5n2/8/4p3/1P1P4/PBP1PPPP/RN1QKBNR w KQkq -
+rnbqkb1r/pppp1ppp/5n2/8/4p3/1P1P3N/PBP1PPPP/RN1QKB1R b KQkq -
+rnbqkb1r/ppp2ppp/5n2/3p4/4p3/1P1P3N/PBP1PPPP/RN1QKB1R w KQkq d6
+rnbqkb1r/ppp2ppp/5n2/3p4/4P3/1P5N/PBP1PPPP/RN1QKB1R b KQkq -
+rnbqkb1r/ppp2ppp/8/3p4/4n3/1P5N/PBP1PPPP/RN1QKB1R w KQkq -
+rnbqkb1r/ppp2ppp/8/3p4/4nN2/1P6/PBP1PPPP/RN1QKB1R b KQkq -
+rnb1kb1r/ppp2ppp/8/3p4/4nN1q/1P6/PBP1PPPP/RN1QKB1R w KQkq -
+rnb1kb1r/ppp2ppp/8/3p4/4nN1q/1P4P1/PBP1PP1P/RN1QKB1R b KQkq -
+rnb1k2r/ppp2ppp/8/2bp4/4nN1q/1P4P1/PBP1PP1P/RN1QKB1R w KQkq -
+rnb1k2r/ppp2ppp/8/2bp4/4nN1q/1P3PP1/PBP1P2P/RN1QKB1R b KQkq -
+rnb1k2r/ppp2ppp/8/3p4/4nN1q/1P3PP1/PBP1Pb1P/RN1QKB1R w KQkq -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppp1ppp/4p3/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppp1ppp/4p3/8/3PP3/8/PPP2PPP/RNBQKBNR b KQkq d3
+rnbqkbnr/ppp2ppp/4p3/3p4/3PP3/8/PPP2PPP/RNBQKBNR w KQkq d6
+rnbqkbnr/ppp2ppp/4p3/3pP3/3P4/8/PPP2PPP/RNBQKBNR b KQkq -
+rnbqkbnr/pp3ppp/4p3/2ppP3/3P4/8/PPP2PPP/RNBQKBNR w KQkq c6
+rnbqkbnr/pp3ppp/4p3/2ppP3/3P4/2P5/PP3PPP/RNBQKBNR b KQkq -
+rnbqkb1r/pp2nppp/4p3/2ppP3/3P4/2P5/PP3PPP/RNBQKBNR w KQkq -
+rnbqkb1r/pp2nppp/4p3/2ppP3/3P1P2/2P5/PP4PP/RNBQKBNR b KQkq f3
+rnbqkb1r/pp2nppp/4p3/3pP3/3p1P2/2P5/PP4PP/RNBQKBNR w KQkq -
+rnbqkb1r/pp2nppp/4p3/3pP3/3P1P2/8/PP4PP/RNBQKBNR b KQkq -
+rnbqkb1r/pp3ppp/4p3/3pPn2/3P1P2/8/PP4PP/RNBQKBNR w KQkq -
+rnbqkb1r/pp3ppp/4p3/3pPn2/3P1P2/5N2/PP4PP/RNBQKB1R b KQkq -
+r1bqkb1r/pp3ppp/2n1p3/3pPn2/3P1P2/5N2/PP4PP/RNBQKB1R w KQkq -
+r1bqkb1r/pp3ppp/2n1p3/1B1pPn2/3P1P2/5N2/PP4PP/RNBQK2R b KQkq -
+r2qkb1r/pp1b1ppp/2n1p3/1B1pPn2/3P1P2/5N2/PP4PP/RNBQK2R w KQkq -
+r2qkb1r/pp1b1ppp/2n1p3/1B1pPn2/3P1P2/5N2/PP4PP/RNBQ1RK1 b kq -
+r3kb1r/pp1b1ppp/1qn1p3/1B1pPn2/3P1P2/5N2/PP4PP/RNBQ1RK1 w kq -
+r3kb1r/pp1b1ppp/1qB1p3/3pPn2/3P1P2/5N2/PP4PP/RNBQ1RK1 b kq -
+r3kb1r/pp3ppp/1qb1p3/3pPn2/3P1P2/5N2/PP4PP/RNBQ1RK1 w kq -
+r3kb1r/pp3ppp/1qb1p3/3pPn2/3P1P2/2N2N2/PP4PP/R1BQ1RK1 b kq -
+r3k2r/pp2bppp/1qb1p3/3pPn2/3P1P2/2N2N2/PP4PP/R1BQ1RK1 w kq -
+r3k2r/pp2bppp/1qb1p3/3pPn2/3P1P2/P1N2N2/1P4PP/R1BQ1RK1 b kq -
+r4rk1/pp2bppp/1qb1p3/3pPn2/3P1P2/P1N2N2/1P4PP/R1BQ1RK1 w - -
+r4rk1/pp2bppp/1qb1p3/3pPn2/1P1P1P2/P1N2N2/6PP/R1BQ1RK1 b - b3
+2r2rk1/pp2bppp/1qb1p3/3pPn2/1P1P1P2/P1N2N2/6PP/R1BQ1RK1 w - -
+2r2rk1/pp2bppp/1qb1p3/3pPn2/1P1P1P2/P1N2N2/1B4PP/R2Q1RK1 b - -
+2r2rk1/pp2bppp/1q2p3/1b1pPn2/1P1P1P2/P1N2N2/1B4PP/R2Q1RK1 w - -
+2r2rk1/pp2bppp/1q2p3/1b1pPn2/1P1P1P2/P1N2N2/1B3RPP/R2Q2K1 b - -
+2r2rk1/pp2bppp/1q2p3/3pPn2/1PbP1P2/P1N2N2/1B3RPP/R2Q2K1 w - -
+2r2rk1/pp2bppp/1q2p3/3pPn2/NPbP1P2/P4N2/1B3RPP/R2Q2K1 b - -
+2r2rk1/pp2bppp/2q1p3/3pPn2/NPbP1P2/P4N2/1B3RPP/R2Q2K1 w - -
+2r2rk1/pp2bppp/2q1p3/2NpPn2/1PbP1P2/P4N2/1B3RPP/R2Q2K1 b - -
+2r2rk1/p3bppp/1pq1p3/2NpPn2/1PbP1P2/P4N2/1B3RPP/R2Q2K1 w - -
+2r2rk1/p3bppp/1pq1p3/3pPn2/1PbP1P2/P2N1N2/1B3RPP/R2Q2K1 b - -
+2r2rk1/4bppp/1pq1p3/p2pPn2/1PbP1P2/P2N1N2/1B3RPP/R2Q2K1 w - a6
+2r2rk1/4bppp/1pq1p3/p2pPn2/1PbP1P2/P1BN1N2/5RPP/R2Q2K1 b - -
+2r2rk1/4bppp/1pq1p3/3pPn2/pPbP1P2/P1BN1N2/5RPP/R2Q2K1 w - -
+2r2rk1/4bppp/1pq1p3/3pPn2/pPbP1PP1/P1BN1N2/5R1P/R2Q2K1 b - g3
+2r2rk1/4bppp/1pq1p3/3pPn2/pP1P1PP1/P1Bb1N2/5R1P/R2Q2K1 w - -
+2r2rk1/4bppp/1pq1p3/3pPn2/pP1P1PP1/P1BQ1N2/5R1P/R5K1 b - -
+2r2rk1/4bppp/1p2p3/3pPn2/pP1P1PP1/P1qQ1N2/5R1P/R5K1 w - -
+2r2rk1/4bppp/1p2p3/3pPn2/pP1P1PP1/P1Q2N2/5R1P/R5K1 b - -
+5rk1/4bppp/1p2p3/3pPn2/pP1P1PP1/P1r2N2/5R1P/R5K1 w - -
+5rk1/4bppp/1p2p3/3pPP2/pP1P1P2/P1r2N2/5R1P/R5K1 b - -
+5rk1/4bppp/1p6/3pPp2/pP1P1P2/P1r2N2/5R1P/R5K1 w - -
+5rk1/4bppp/1p6/3pPp2/pP1P1P2/P1r2N2/5RKP/R7 b - -
+2r3k1/4bppp/1p6/3pPp2/pP1P1P2/P1r2N2/5RKP/R7 w - -
+2r3k1/4bppp/1p6/3pPp2/pP1P1P2/P1r2N2/R4RKP/8 b - -
+2r3k1/4bpp1/1p6/3pPp1p/pP1P1P2/P1r2N2/R4RKP/8 w - h6
+2r3k1/4bpp1/1p6/3pPp1p/pP1P1P1P/P1r2N2/R4RK1/8 b - h3
+6k1/4bpp1/1pr5/3pPp1p/pP1P1P1P/P1r2N2/R4RK1/8 w - -
+6k1/4bpp1/1pr5/3pPpNp/pP1P1P1P/P1r5/R4RK1/8 b - -
+6k1/4b1p1/1pr2p2/3pPpNp/pP1P1P1P/P1r5/R4RK1/8 w - -
+6k1/4b1p1/1pr2P2/3p1pNp/pP1P1P1P/P1r5/R4RK1/8 b - -
+6k1/6p1/1pr2b2/3p1pNp/pP1P1P1P/P1r5/R4RK1/8 w - -
+6k1/6p1/1pr2b2/3p1p1p/pP1P1P1P/P1r2N2/R4RK1/8 b - -
+6k1/8/1pr2bp1/3p1p1p/pP1P1P1P/P1r2N2/R4RK1/8 w - -
+6k1/8/1pr2bp1/3pNp1p/pP1P1P1P/P1r5/R4RK1/8 b - -
+6k1/8/1pr3p1/3pbp1p/pP1P1P1P/P1r5/R4RK1/8 w - -
+6k1/8/1pr3p1/3pPp1p/pP1P3P/P1r5/R4RK1/8 b - -
+8/6k1/1pr3p1/3pPp1p/pP1P3P/P1r5/R4RK1/8 w - -
+8/6k1/1pr3p1/3pPp1p/pP1P3P/P1r5/R3R1K1/8 b - -
+8/6k1/1pr3p1/3pPp1p/pP1P3P/P2r4/R3R1K1/8 w - -
+8/6k1/1pr1P1p1/3p1p1p/pP1P3P/P2r4/R3R1K1/8 b - -
+8/6k1/1pr1P1p1/3p1p1p/pP1r3P/P7/R3R1K1/8 w - -
+8/4P1k1/1pr3p1/3p1p1p/pP1r3P/P7/R3R1K1/8 b - -
+8/4P1k1/1pr3p1/3p1p1p/pP4rP/P7/R3R1K1/8 w - -
+8/4P1k1/1pr3p1/3p1p1p/pP4rP/P7/R3RK2/8 b - -
+8/4P1k1/1pr3p1/3p1p1p/pP2r2P/P7/R3RK2/8 w - -
+8/4P1k1/1pr3p1/3p1p1p/pP2R2P/P7/R4K2/8 b - -
+8/4P1k1/1pr3p1/5p1p/pP2p2P/P7/R4K2/8 w - -
+4Q3/6k1/1pr3p1/5p1p/pP2p2P/P7/R4K2/8 b - -
+4Q3/6k1/1p4p1/5p1p/pP2p2P/P1r5/R4K2/8 w - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppp1ppp/4p3/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppp1ppp/4p3/8/3PP3/8/PPP2PPP/RNBQKBNR b KQkq d3
+rnbqkbnr/p1pp1ppp/1p2p3/8/3PP3/8/PPP2PPP/RNBQKBNR w KQkq -
+rnbqkbnr/p1pp1ppp/1p2p3/3P4/4P3/8/PPP2PPP/RNBQKBNR b KQkq -
+rnbqk1nr/p1pp1ppp/1p2p3/3P4/1b2P3/8/PPP2PPP/RNBQKBNR w KQkq -
+rnbqk1nr/p1pp1ppp/1p2p3/3P4/1b2P3/2P5/PP3PPP/RNBQKBNR b KQkq -
+rnbqk1nr/p1pp1ppp/1p2p3/2bP4/4P3/2P5/PP3PPP/RNBQKBNR w KQkq -
+rnbqk1nr/p1pp1ppp/1p2p3/2bP4/1P2P3/2P5/P4PPP/RNBQKBNR b KQkq b3
+rnbqk1nr/p1pp1ppp/1p1bp3/3P4/1P2P3/2P5/P4PPP/RNBQKBNR w KQkq -
+rnbqk1nr/p1pp1ppp/1p1bp3/3P4/1P2P3/2P2N2/P4PPP/RNBQKB1R b KQkq -
+rnbqk1nr/p1pp1ppp/1p1b4/3p4/1P2P3/2P2N2/P4PPP/RNBQKB1R w KQkq -
+rnbqk1nr/p1pp1ppp/1p1b4/3pP3/1P6/2P2N2/P4PPP/RNBQKB1R b KQkq -
+rnb1k1nr/p1ppqppp/1p1b4/3pP3/1P6/2P2N2/P4PPP/RNBQKB1R w KQkq -
+rnb1k1nr/p1ppqppp/1p1b4/3QP3/1P6/2P2N2/P4PPP/RNB1KB1R b KQkq -
+rnb1k1nr/p1ppqppp/1p6/3Qb3/1P6/2P2N2/P4PPP/RNB1KB1R w KQkq -
+rnb1k1nr/p1ppqppp/1p6/3QN3/1P6/2P5/P4PPP/RNB1KB1R b KQkq -
+rnb1k1nr/p2pqppp/1pp5/3QN3/1P6/2P5/P4PPP/RNB1KB1R w KQkq -
+rnb1k1nr/p2pqQpp/1pp5/4N3/1P6/2P5/P4PPP/RNB1KB1R b KQkq -
+rnb1k1nr/p2p1qpp/1pp5/4N3/1P6/2P5/P4PPP/RNB1KB1R w KQkq -
+rnb1k1nr/p2p1Npp/1pp5/8/1P6/2P5/P4PPP/RNB1KB1R b KQkq -
+rnb3nr/p2p1kpp/1pp5/8/1P6/2P5/P4PPP/RNB1KB1R w KQ -
+rnb3nr/p2p1kpp/1pp5/8/1PB5/2P5/P4PPP/RNB1K2R b KQ -
+rnb1k1nr/p2p2pp/1pp5/8/1PB5/2P5/P4PPP/RNB1K2R w KQ -
+rnb1k1nr/p2p2pp/1pp5/8/1PB5/2P5/P4PPP/RNB2RK1 b - -
+rnb1k1nr/p5pp/1pp5/3p4/1PB5/2P5/P4PPP/RNB2RK1 w - d6
+rnb1k1nr/p5pp/1pp5/3p4/1PB5/2P5/P4PPP/RNB1R1K1 b - -
+rnbk2nr/p5pp/1pp5/3p4/1PB5/2P5/P4PPP/RNB1R1K1 w - -
+rnbk2nr/p5pp/1pp5/3p2B1/1PB5/2P5/P4PPP/RN2R1K1 b - -
+rnb3nr/p1k3pp/1pp5/3p2B1/1PB5/2P5/P4PPP/RN2R1K1 w - -
+rnb3nr/p1k3pp/1pp5/3p2B1/1P6/1BP5/P4PPP/RN2R1K1 b - -
+r1b3nr/p1kn2pp/1pp5/3p2B1/1P6/1BP5/P4PPP/RN2R1K1 w - -
+r1b3nr/p1kn2pp/1pp5/3p2B1/1PP5/1B6/P4PPP/RN2R1K1 b - -
+r1b4r/p1kn2pp/1pp2n2/3p2B1/1PP5/1B6/P4PPP/RN2R1K1 w - -
+r1b4r/p1kn2pp/1pp2n2/3p4/1PP2B2/1B6/P4PPP/RN2R1K1 b - -
+r1b4r/pk1n2pp/1pp2n2/3p4/1PP2B2/1B6/P4PPP/RN2R1K1 w - -
+r1b4r/pk1n2pp/1pp2n2/3P4/1P3B2/1B6/P4PPP/RN2R1K1 b - -
+r1b4r/pk1n2pp/1pp5/3n4/1P3B2/1B6/P4PPP/RN2R1K1 w - -
+r1b4r/pk1n2pp/1pp5/3B4/1P3B2/8/P4PPP/RN2R1K1 b - -
+r1b4r/pk1n2pp/1p6/3p4/1P3B2/8/P4PPP/RN2R1K1 w - -
+r1b4r/pk1n2pp/1p6/3p4/1P3B2/2N5/P4PPP/R3R1K1 b - -
+r1b4r/pk4pp/1p3n2/3p4/1P3B2/2N5/P4PPP/R3R1K1 w - -
+r1b4r/pk4pp/1p3n2/3p4/PP3B2/2N5/5PPP/R3R1K1 b - a3
+r6r/pk1b2pp/1p3n2/3p4/PP3B2/2N5/5PPP/R3R1K1 w - -
+r6r/pk1b2pp/1p3n2/P2p4/1P3B2/2N5/5PPP/R3R1K1 b - -
+r6r/pk1b2pp/5n2/Pp1p4/1P3B2/2N5/5PPP/R3R1K1 w - -
+r6r/pk1b2pp/P4n2/1p1p4/1P3B2/2N5/5PPP/R3R1K1 b - -
+r6r/p2b2pp/P1k2n2/1p1p4/1P3B2/2N5/5PPP/R3R1K1 w - -
+r6r/p2b2pp/P1k2n2/1p1pB3/1P6/2N5/5PPP/R3R1K1 b - -
+4r2r/p2b2pp/P1k2n2/1p1pB3/1P6/2N5/5PPP/R3R1K1 w - -
+4r2r/p2b2pp/P1k2n2/1p1pB3/1P3P2/2N5/6PP/R3R1K1 b - f3
+7r/p2b2pp/P1k1rn2/1p1pB3/1P3P2/2N5/6PP/R3R1K1 w - -
+7r/p2b2pp/P1k1rn2/1p1pB3/1P3P2/2N5/6PP/R1R3K1 b - -
+7r/p2b2pp/Pk2rn2/1p1pB3/1P3P2/2N5/6PP/R1R3K1 w - -
+7r/p2b2pp/Pk2rn2/1p1p4/1P1B1P2/2N5/6PP/R1R3K1 b - -
+7r/p1kb2pp/P3rn2/1p1p4/1P1B1P2/2N5/6PP/R1R3K1 w - -
+7r/p1kb2pp/P3rn2/1N1p4/1P1B1P2/8/6PP/R1R3K1 b - -
+1k5r/p2b2pp/P3rn2/1N1p4/1P1B1P2/8/6PP/R1R3K1 w - -
+1k5r/p1Nb2pp/P3rn2/3p4/1P1B1P2/8/6PP/R1R3K1 b - -
+1k5r/p1Nb2pp/P1r2n2/3p4/1P1B1P2/8/6PP/R1R3K1 w - -
+1k5r/p1Nb2pp/P1R2n2/3p4/1P1B1P2/8/6PP/R5K1 b - -
+1k5r/p1N3pp/P1b2n2/3p4/1P1B1P2/8/6PP/R5K1 w - -
+1k5r/p1N3pp/P1b2B2/3p4/1P3P2/8/6PP/R5K1 b - -
+7r/p1k3pp/P1b2B2/3p4/1P3P2/8/6PP/R5K1 w - -
+7r/p1k3Bp/P1b5/3p4/1P3P2/8/6PP/R5K1 b - -
+6r1/p1k3Bp/P1b5/3p4/1P3P2/8/6PP/R5K1 w - -
+6r1/p1k4p/P1b5/3pB3/1P3P2/8/6PP/R5K1 b - -
+6r1/p6p/Pkb5/3pB3/1P3P2/8/6PP/R5K1 w - -
+6r1/p6p/Pkb5/3p4/1P1B1P2/8/6PP/R5K1 b - -
+6r1/p6p/P1b5/1k1p4/1P1B1P2/8/6PP/R5K1 w - -
+6r1/p6p/P1b5/Rk1p4/1P1B1P2/8/6PP/6K1 b - -
+6r1/p6p/P1b5/R2p4/1k1B1P2/8/6PP/6K1 w - -
+6r1/p6p/P1b5/3p4/1k1B1P2/8/6PP/R5K1 b - -
+6r1/p6p/P1b5/3p4/2kB1P2/8/6PP/R5K1 w - -
+6r1/B6p/P1b5/3p4/2k2P2/8/6PP/R5K1 b - -
+6r1/B6p/P1b5/8/2kp1P2/8/6PP/R5K1 w - -
+6r1/B6p/P1b5/8/2kp1P2/8/6PP/2R3K1 b - -
+6r1/B6p/P1b5/3k4/3p1P2/8/6PP/2R3K1 w - -
+6r1/B6p/P1b5/3k4/3p1P2/8/6PP/3R2K1 b - -
+6r1/B6p/P1b5/8/3pkP2/8/6PP/3R2K1 w - -
+6r1/B6p/P1b5/8/3RkP2/8/6PP/6K1 b - -
+6r1/B6p/P1b5/8/3R1P2/4k3/6PP/6K1 w - -
+6r1/7p/P1b5/2B5/3R1P2/4k3/6PP/6K1 b - -
+8/7p/P1b5/2B5/3R1P2/4k3/6rP/6K1 w - -
+8/7p/P1b5/2B5/3R1P2/4k3/6rP/5K2 b - -
+8/7p/P1b5/2B5/3R1P2/4k3/5r1P/5K2 w - -
+8/7p/P1b5/2B5/3R1P2/4k3/5r1P/4K3 b - -
+8/7p/P1b5/2B5/3R1P2/4k3/7r/4K3 w - -
+8/7p/P1b5/2B5/3R1P2/4k3/7r/3K4 b - -
+8/7p/P7/2B5/3R1P2/4kb2/7r/3K4 w - -
+8/7p/P7/2B5/3R1P2/4kb2/7r/2K5 b - -
+8/7p/P7/2B5/3R1P1r/4kb2/8/2K5 w - -
+8/7p/P7/2B5/R4P1r/4kb2/8/2K5 b - -
+8/7p/P7/2B5/R4P1r/3k1b2/8/2K5 w - -
+8/7p/P7/2B5/5P1r/R2k1b2/8/2K5 b - -
+8/7p/P7/2B5/5P1r/R4b2/4k3/2K5 w - -
+8/7p/P7/2B5/5P1r/4Rb2/4k3/2K5 b - -
+8/7p/P7/2B5/5P1r/4Rb2/5k2/2K5 w - -
+8/7p/P7/2B1R3/5P1r/5b2/5k2/2K5 b - -
+8/7p/P7/2B1R3/5P1r/5bk1/8/2K5 w - -
+8/7p/P7/2B3R1/5P1r/5bk1/8/2K5 b - -
+8/7p/P7/2B3R1/5P1r/5b1k/8/2K5 w - -
+8/7p/P2B4/6R1/5P1r/5b1k/8/2K5 b - -
+8/7p/P2B4/6R1/5Pr1/5b1k/8/2K5 w - -
+8/7p/P2B4/7R/5Pr1/5b1k/8/2K5 b - -
+8/7p/P2B4/7R/5Pr1/5bk1/8/2K5 w - -
+8/7p/P2B4/5P1R/6r1/5bk1/8/2K5 b - -
+8/7p/P2B4/5P1R/6r1/5b2/5k2/2K5 w - -
+8/7R/P2B4/5P2/6r1/5b2/5k2/2K5 b - -
+8/7R/P2B4/5P2/2r5/5b2/5k2/2K5 w - -
+8/7R/P2B4/5P2/2r5/5b2/1K3k2/8 b - -
+8/7R/P2B4/5P2/2r5/5b2/1K2k3/8 w - -
+8/P6R/3B4/5P2/2r5/5b2/1K2k3/8 b - -
+8/P6R/3B4/5P2/2r5/5b2/1K1k4/8 w - -
+8/P7/3B4/5P2/2r5/5b2/1K1k3R/8 b - -
+8/P7/3B4/5P2/2r5/5b2/1K5R/3k4 w - -
+8/P7/3B4/5P2/2r5/5b2/1K3R2/3k4 b - -
+b7/P7/3B4/5P2/2r5/8/1K3R2/3k4 w - -
+b7/P7/3B1P2/8/2r5/8/1K3R2/3k4 b - -
+b7/P7/2rB1P2/8/8/8/1K3R2/3k4 w - -
+b7/P3B3/2r2P2/8/8/8/1K3R2/3k4 b - -
+b7/P3B3/1r3P2/8/8/8/1K3R2/3k4 w - -
+b7/P3B3/1r3P2/8/8/2K5/5R2/3k4 b - -
+b7/P3B3/1r3P2/8/8/2K5/5R2/4k3 w - -
+b7/P3B3/1r3P2/5R2/8/2K5/8/4k3 b - -
+b7/P3B3/1r3P2/5R2/8/2K5/4k3/8 w - -
+b7/P3BP2/1r6/5R2/8/2K5/4k3/8 b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/ppp1pppp/8/3p4/4P3/8/PPPP1PPP/RNBQKBNR w KQkq d6
+rnbqkbnr/ppp1pppp/8/3P4/8/8/PPPP1PPP/RNBQKBNR b KQkq -
+rnb1kbnr/ppp1pppp/8/3q4/8/8/PPPP1PPP/RNBQKBNR w KQkq -
+rnb1kbnr/ppp1pppp/8/3q4/8/2N5/PPPP1PPP/R1BQKBNR b KQkq -
+rnb1kbnr/ppp1pppp/8/4q3/8/2N5/PPPP1PPP/R1BQKBNR w KQkq -
+rnb1kbnr/ppp1pppp/8/4q3/8/2N5/PPPPBPPP/R1BQK1NR b KQkq -
+rn2kbnr/ppp1pppp/8/4q3/6b1/2N5/PPPPBPPP/R1BQK1NR w KQkq -
+rn2kbnr/ppp1pppp/8/4q3/3P2b1/2N5/PPP1BPPP/R1BQK1NR b KQkq d3
+rn2kbnr/ppp1pppp/4q3/8/3P2b1/2N5/PPP1BPPP/R1BQK1NR w KQkq -
+rn2kbnr/ppp1pppp/4q3/8/3P2b1/2N1B3/PPP1BPPP/R2QK1NR b KQkq -
+r3kbnr/ppp1pppp/2n1q3/8/3P2b1/2N1B3/PPP1BPPP/R2QK1NR w KQkq -
+r3kbnr/ppp1pppp/2n1q3/8/3P2B1/2N1B3/PPP2PPP/R2QK1NR b KQkq -
+r3kbnr/ppp1pppp/2n3q1/8/3P2B1/2N1B3/PPP2PPP/R2QK1NR w KQkq -
+r3kbnr/ppp1pppp/2n3q1/8/3P4/2N1BB2/PPP2PPP/R2QK1NR b KQkq -
+r3kbnr/ppp1pppp/6q1/8/1n1P4/2N1BB2/PPP2PPP/R2QK1NR w KQkq -
+r3kbnr/ppp1pppp/6q1/8/1n1PB3/2N1B3/PPP2PPP/R2QK1NR b KQkq -
+r3kbnr/ppp1pppp/q7/8/1n1PB3/2N1B3/PPP2PPP/R2QK1NR w KQkq -
+r3kbnr/ppp1pppp/q7/1N6/1n1PB3/4B3/PPP2PPP/R2QK1NR b KQkq -
+r3kbnr/ppp1pppp/8/1q6/1n1PB3/4B3/PPP2PPP/R2QK1NR w KQkq -
+r3kbnr/ppp1pppp/8/1q6/1n1PB3/2P1B3/PP3PPP/R2QK1NR b KQkq -
+r3kbnr/ppp1pppp/8/1q1n4/3PB3/2P1B3/PP3PPP/R2QK1NR w KQkq -
+r3kbnr/ppp1pppp/8/1q1n4/3P4/2PBB3/PP3PPP/R2QK1NR b KQkq -
+r3kbnr/ppp1pppp/8/3n4/3P4/2PBB3/Pq3PPP/R2QK1NR w KQkq -
+r3kbnr/ppp1pppp/8/3n4/3P4/2PBB3/Pq2NPPP/R2QK2R b KQkq -
+r3kbnr/ppp1pppp/8/8/3P4/2nBB3/Pq2NPPP/R2QK2R w KQkq -
+r3kbnr/ppp1pppp/8/8/3P4/2NBB3/Pq3PPP/R2QK2R b KQkq -
+r3kbnr/ppp1pppp/8/8/3P4/2qBB3/P4PPP/R2QK2R w KQkq -
+r3kbnr/ppp1pppp/8/8/3P4/2qBB3/P3KPPP/R2Q3R b kq -
+r3kbnr/ppp1pppp/8/8/3P4/3BB3/Pq2KPPP/R2Q3R w kq -
+r3kbnr/ppp1pppp/8/8/3P4/3BBK2/Pq3PPP/R2Q3R b kq -
+2kr1bnr/ppp1pppp/8/8/3P4/3BBK2/Pq3PPP/R2Q3R w - -
+2kr1bnr/ppp1pppp/8/8/Q2P4/3BBK2/Pq3PPP/R6R b - -
+2kr1bnr/ppp2ppp/4p3/8/Q2P4/3BBK2/Pq3PPP/R6R w - -
+2kr1bnr/Qpp2ppp/4p3/8/3P4/3BBK2/Pq3PPP/R6R b - -
+2kr1bnr/Qpp2ppp/4p3/8/3P4/q2BBK2/P4PPP/R6R w - -
+2kr1bnr/1pp2ppp/4p3/8/3P4/Q2BBK2/P4PPP/R6R b - -
+2kr2nr/1pp2ppp/4p3/8/3P4/b2BBK2/P4PPP/R6R w - -
+2kr2nr/1pp2ppp/4p3/8/3P4/b2BBK2/P4PPP/1R5R b - -
+2kr3r/1pp2ppp/4pn2/8/3P4/b2BBK2/P4PPP/1R5R w - -
+2kr3r/1pp2ppp/4pn2/8/3P4/bR1BBK2/P4PPP/7R b - -
+2kr3r/1pp2ppp/3bpn2/8/3P4/1R1BBK2/P4PPP/7R w - -
+2kr3r/1pp2ppp/3bpn2/8/3P4/1R1BBK2/P4PPP/1R6 b - -
+2kr3r/2p2ppp/1p1bpn2/8/3P4/1R1BBK2/P4PPP/1R6 w - -
+2kr3r/2p2ppp/1p1bpn2/1B6/3P4/1R2BK2/P4PPP/1R6 b - -
+2kr3r/2p2ppp/1p1bp3/1B1n4/3P4/1R2BK2/P4PPP/1R6 w - -
+2kr3r/2p2ppp/1p1bp3/1B1n4/P2P4/1R2BK2/5PPP/1R6 b - a3
+3r3r/1kp2ppp/1p1bp3/1B1n4/P2P4/1R2BK2/5PPP/1R6 w - -
+3r3r/1kp2ppp/1p1bp3/PB1n4/3P4/1R2BK2/5PPP/1R6 b - -
+3r3r/1k3ppp/1ppbp3/PB1n4/3P4/1R2BK2/5PPP/1R6 w - -
+3r3r/1k3ppp/1ppbp3/P2n4/2BP4/1R2BK2/5PPP/1R6 b - -
+3r3r/1k3ppp/2pbp3/Pp1n4/2BP4/1R2BK2/5PPP/1R6 w - -
+3r3r/1k3ppp/2pbp3/Pp1B4/3P4/1R2BK2/5PPP/1R6 b - -
+3r3r/1k3ppp/2pb4/Pp1p4/3P4/1R2BK2/5PPP/1R6 w - -
+3r3r/1k3ppp/2pb4/Pp1p4/3P1B2/1R3K2/5PPP/1R6 b - -
+3r3r/1k2bppp/2p5/Pp1p4/3P1B2/1R3K2/5PPP/1R6 w - -
+3r3r/1k2bppp/2p5/Pp1p4/3P1B2/4RK2/5PPP/1R6 b - -
+3rr3/1k2bppp/2p5/Pp1p4/3P1B2/4RK2/5PPP/1R6 w - -
+3rr3/1k2bppp/2p5/Pp1p4/3P1B2/4RK2/5PPP/4R3 b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppp1ppp/8/4p3/4P3/8/PPPP1PPP/RNBQKBNR w KQkq e6
+rnbqkbnr/pppp1ppp/8/4p3/2B1P3/8/PPPP1PPP/RNBQK1NR b KQkq -
+rnbqkb1r/pppp1ppp/5n2/4p3/2B1P3/8/PPPP1PPP/RNBQK1NR w KQkq -
+rnbqkb1r/pppp1ppp/5n2/4p3/2B1P3/3P4/PPP2PPP/RNBQK1NR b KQkq -
+rnbqk2r/pppp1ppp/5n2/2b1p3/2B1P3/3P4/PPP2PPP/RNBQK1NR w KQkq -
+rnbqk2r/pppp1ppp/5n2/2b1p1B1/2B1P3/3P4/PPP2PPP/RN1QK1NR b KQkq -
+rnbqk2r/pppp1ppp/5n2/4p1B1/2B1P3/3P4/PPP2bPP/RN1QK1NR w KQkq -
+rnbqk2r/pppp1ppp/5n2/4p1B1/2B1P3/3P4/PPP2KPP/RN1Q2NR b kq -
+rnbqk2r/pppp1ppp/8/4p1B1/2B1n3/3P4/PPP2KPP/RN1Q2NR w kq -
+rnbqk2r/pppp1ppp/8/4p1B1/2B1P3/8/PPP2KPP/RN1Q2NR b kq -
+rnb1k2r/pppp1ppp/8/4p1q1/2B1P3/8/PPP2KPP/RN1Q2NR w kq -
+rnb1k2r/pppp1ppp/8/4p1q1/2B1P3/5N2/PPP2KPP/RN1Q3R b kq -
+rnb1k2r/pppp1ppp/5q2/4p3/2B1P3/5N2/PPP2KPP/RN1Q3R w kq -
+rnb1k2r/pppp1ppp/5q2/3Qp3/2B1P3/5N2/PPP2KPP/RN5R b kq -
+r1b1k2r/pppp1ppp/2n2q2/3Qp3/2B1P3/5N2/PPP2KPP/RN5R w kq -
+r1b1k2r/pppp1ppp/2n2q2/3Qp3/2B1P3/5N2/PPP2KPP/RN3R2 b kq -
+r1b2rk1/pppp1ppp/2n2q2/3Qp3/2B1P3/5N2/PPP2KPP/RN3R2 w - -
+r1b2rk1/pppp1ppp/2n2q2/3Qp3/2B1P3/5N2/PPP3PP/RN3RK1 b - -
+r1b2rk1/pppp1ppp/5q2/3Qp3/1nB1P3/5N2/PPP3PP/RN3RK1 w - -
+r1b2rk1/pppp1ppp/5q2/4Q3/1nB1P3/5N2/PPP3PP/RN3RK1 b - -
+r1b2rk1/pppp1ppp/8/4q3/1nB1P3/5N2/PPP3PP/RN3RK1 w - -
+r1b2rk1/pppp1ppp/8/4N3/1nB1P3/8/PPP3PP/RN3RK1 b - -
+r1b2rk1/pppp1ppp/8/4N3/2B1P3/8/PPn3PP/RN3RK1 w - -
+r1b2rk1/pppp1Bpp/8/4N3/4P3/8/PPn3PP/RN3RK1 b - -
+r1b2r1k/pppp1Bpp/8/4N3/4P3/8/PPn3PP/RN3RK1 w - -
+r1b2r1k/pppp2pp/8/4N3/2B1P3/8/PPn3PP/RN3RK1 b - -
+r1b4k/pppp2pp/8/4N3/2B1P3/8/PPn3PP/RN3rK1 w - -
+r1b4k/pppp2pp/8/4N3/4P3/8/PPn3PP/RN3BK1 b - -
+r1b4k/pppp2pp/8/4N3/4P3/8/PP4PP/nN3BK1 w - -
+r1b4k/pppp2pp/8/4N3/4P3/2N5/PP4PP/n4BK1 b - -
+r1b4k/pppp2pp/8/4N3/4P3/2N5/PPn3PP/5BK1 w - -
+r1b4k/pppp2pp/8/3NN3/4P3/8/PPn3PP/5BK1 b - -
+r1b4k/pp1p2pp/2p5/3NN3/4P3/8/PPn3PP/5BK1 w - -
+r1b4k/pp1pN1pp/2p5/4N3/4P3/8/PPn3PP/5BK1 b - -
+r1b4k/pp2N1pp/2pp4/4N3/4P3/8/PPn3PP/5BK1 w - -
+r1b4k/pp2NNpp/2pp4/8/4P3/8/PPn3PP/5BK1 b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppp1ppp/8/4p3/4P3/8/PPPP1PPP/RNBQKBNR w KQkq e6
+rnbqkbnr/pppp1ppp/8/4p3/4PP2/8/PPPP2PP/RNBQKBNR b KQkq f3
+rnbqkbnr/ppp2ppp/3p4/4p3/4PP2/8/PPPP2PP/RNBQKBNR w KQkq -
+rnbqkbnr/ppp2ppp/3p4/4p3/4PP2/5N2/PPPP2PP/RNBQKB1R b KQkq -
+r1bqkbnr/ppp2ppp/2np4/4p3/4PP2/5N2/PPPP2PP/RNBQKB1R w KQkq -
+r1bqkbnr/ppp2ppp/2np4/4p3/3PPP2/5N2/PPP3PP/RNBQKB1R b KQkq d3
+r1bqkbnr/ppp2ppp/2np4/8/3pPP2/5N2/PPP3PP/RNBQKB1R w KQkq -
+r1bqkbnr/ppp2ppp/2np4/8/3NPP2/8/PPP3PP/RNBQKB1R b KQkq -
+r1bqk1nr/ppp1bppp/2np4/8/3NPP2/8/PPP3PP/RNBQKB1R w KQkq -
+r1bqk1nr/ppp1bppp/2Np4/8/4PP2/8/PPP3PP/RNBQKB1R b KQkq -
+r1bqk1nr/p1p1bppp/2pp4/8/4PP2/8/PPP3PP/RNBQKB1R w KQkq -
+r1bqk1nr/p1p1bppp/2pp4/8/2B1PP2/8/PPP3PP/RNBQK2R b KQkq -
+r2qk1nr/p1p1bppp/2ppb3/8/2B1PP2/8/PPP3PP/RNBQK2R w KQkq -
+r2qk1nr/p1p1bppp/2ppB3/8/4PP2/8/PPP3PP/RNBQK2R b KQkq -
+r2qk1nr/p1p1b1pp/2ppp3/8/4PP2/8/PPP3PP/RNBQK2R w KQkq -
+r2qk1nr/p1p1b1pp/2ppp3/8/2P1PP2/8/PP4PP/RNBQK2R b KQkq c3
+r2qk2r/p1p1b1pp/2ppp2n/8/2P1PP2/8/PP4PP/RNBQK2R w KQkq -
+r2qk2r/p1p1b1pp/2ppp2n/8/2P1PP2/2N5/PP4PP/R1BQK2R b KQkq -
+r2q1rk1/p1p1b1pp/2ppp2n/8/2P1PP2/2N5/PP4PP/R1BQK2R w KQ -
+r2q1rk1/p1p1b1pp/2ppp2n/8/2P1PP2/2N5/PP4PP/R1BQ1RK1 b - -
+r2q1rk1/p1p1b1pp/2pp3n/4p3/2P1PP2/2N5/PP4PP/R1BQ1RK1 w - -
+r2q1rk1/p1p1b1pp/2pp3n/4pP2/2P1P3/2N5/PP4PP/R1BQ1RK1 b - -
+r2q1rk1/p1p1bnpp/2pp4/4pP2/2P1P3/2N5/PP4PP/R1BQ1RK1 w - -
+r2q1rk1/p1p1bnpp/2pp4/4pP2/1PP1P3/2N5/P5PP/R1BQ1RK1 b - b3
+r2q1rk1/p1p2npp/2pp4/4pPb1/1PP1P3/2N5/P5PP/R1BQ1RK1 w - -
+r2q1rk1/p1p2npp/2pp4/1P2pPb1/2P1P3/2N5/P5PP/R1BQ1RK1 b - -
+r2q1rk1/p1p2npp/2pp4/1P2pP2/2P1P3/2N5/P5PP/R1bQ1RK1 w - -
+r2q1rk1/p1p2npp/2pp4/1P2pP2/2P1P3/2N5/P5PP/2RQ1RK1 b - -
+r2q1rk1/p1p3pp/2pp4/1P2pPn1/2P1P3/2N5/P5PP/2RQ1RK1 w - -
+r2q1rk1/p1p3pp/2Pp4/4pPn1/2P1P3/2N5/P5PP/2RQ1RK1 b - -
+r2q1rk1/2p3pp/p1Pp4/4pPn1/2P1P3/2N5/P5PP/2RQ1RK1 w - -
+r2q1rk1/2p3pp/p1Pp4/4pPn1/2P1P3/2N5/P5PP/2RQR1K1 b - -
+r2q1rk1/2p4p/p1Pp2p1/4pPn1/2P1P3/2N5/P5PP/2RQR1K1 w - -
+r2q1rk1/2p4p/p1Pp2P1/4p1n1/2P1P3/2N5/P5PP/2RQR1K1 b - -
+r2q1rk1/2p5/p1Pp2p1/4p1n1/2P1P3/2N5/P5PP/2RQR1K1 w - -
+r2q1rk1/2p5/p1Pp2p1/3Np1n1/2P1P3/8/P5PP/2RQR1K1 b - -
+r2q1rk1/2p5/p1Ppn1p1/3Np3/2P1P3/8/P5PP/2RQR1K1 w - -
+r2q1rk1/2p5/p1Ppn1p1/3Np3/2P1P1Q1/8/P5PP/2R1R1K1 b - -
+r3qrk1/2p5/p1Ppn1p1/3Np3/2P1P1Q1/8/P5PP/2R1R1K1 w - -
+r3qrk1/2p5/p1Ppn1p1/3Np3/2P1P1Q1/8/P5PP/2R2RK1 b - -
+r3qrk1/2p5/p1Pp2p1/3Np3/2P1PnQ1/8/P5PP/2R2RK1 w - -
+r3qrk1/2p5/p1Pp2p1/4p3/2P1PNQ1/8/P5PP/2R2RK1 b - -
+r3q1k1/2p5/p1Pp2p1/4p3/2P1PrQ1/8/P5PP/2R2RK1 w - -
+r3q1k1/2p5/p1Pp2p1/4p3/2P1PRQ1/8/P5PP/2R3K1 b - -
+r3q1k1/2p5/p1Pp2p1/8/2P1PpQ1/8/P5PP/2R3K1 w - -
+r3q1k1/2p5/p1Pp2p1/8/2P1PQ2/8/P5PP/2R3K1 b - -
+r5k1/2p5/p1qp2p1/8/2P1PQ2/8/P5PP/2R3K1 w - -
+r5k1/2p5/p1qp1Qp1/8/2P1P3/8/P5PP/2R3K1 b - -
+r5k1/2pq4/p2p1Qp1/8/2P1P3/8/P5PP/2R3K1 w - -
+r5k1/2pq4/p2p1Qp1/2P5/4P3/8/P5PP/2R3K1 b - -
+5rk1/2pq4/p2p1Qp1/2P5/4P3/8/P5PP/2R3K1 w - -
+5rk1/2pq4/p2p2Q1/2P5/4P3/8/P5PP/2R3K1 b - -
+5r1k/2pq4/p2p2Q1/2P5/4P3/8/P5PP/2R3K1 w - -
+5r1k/2pq4/p2P2Q1/8/4P3/8/P5PP/2R3K1 b - -
+5r1k/3q4/p2p2Q1/8/4P3/8/P5PP/2R3K1 w - -
+5r1k/3q4/p2p2Q1/8/4P3/8/P5PP/3R2K1 b - -
+6rk/3q4/p2p2Q1/8/4P3/8/P5PP/3R2K1 w - -
+6rk/3q4/p2p1Q2/8/4P3/8/P5PP/3R2K1 b - -
+6r1/3q3k/p2p1Q2/8/4P3/8/P5PP/3R2K1 w - -
+6r1/3q3k/p2R1Q2/8/4P3/8/P5PP/6K1 b - -
+6r1/q6k/p2R1Q2/8/4P3/8/P5PP/6K1 w - -
+6r1/q6k/p2R1Q2/8/4P3/8/P5PP/5K2 b - -
+8/q5rk/p2R1Q2/8/4P3/8/P5PP/5K2 w - -
+8/q5rk/p2R3Q/8/4P3/8/P5PP/5K2 b - -
+6k1/q5r1/p2R3Q/8/4P3/8/P5PP/5K2 w - -
+3R2k1/q5r1/p6Q/8/4P3/8/P5PP/5K2 b - -
+3R4/q4kr1/p6Q/8/4P3/8/P5PP/5K2 w - -
+3R4/q4kr1/p6Q/4P3/8/8/P5PP/5K2 b - -
+3R4/2q2kr1/p6Q/4P3/8/8/P5PP/5K2 w - -
+3R4/2q2kr1/p4Q2/4P3/8/8/P5PP/5K2 b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppp1ppp/8/4p3/4P3/8/PPPP1PPP/RNBQKBNR w KQkq e6
+rnbqkbnr/pppp1ppp/8/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R b KQkq -
+r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq -
+r1bqkbnr/pppp1ppp/2n5/4p3/2B1P3/5N2/PPPP1PPP/RNBQK2R b KQkq -
+r1bqk1nr/ppppbppp/2n5/4p3/2B1P3/5N2/PPPP1PPP/RNBQK2R w KQkq -
+r1bqk1nr/ppppbppp/2n5/4p3/2BPP3/5N2/PPP2PPP/RNBQK2R b KQkq d3
+r1bqk1nr/ppppbppp/2n5/8/2BpP3/5N2/PPP2PPP/RNBQK2R w KQkq -
+r1bqk1nr/ppppbppp/2n5/8/2BNP3/8/PPP2PPP/RNBQK2R b KQkq -
+r1bqk1nr/ppp1bppp/2np4/8/2BNP3/8/PPP2PPP/RNBQK2R w KQkq -
+r1bqk1nr/ppp1bppp/2np4/8/2BNP3/2N5/PPP2PPP/R1BQK2R b KQkq -
+r1bqk2r/ppp1bppp/2np1n2/8/2BNP3/2N5/PPP2PPP/R1BQK2R w KQkq -
+r1bqk2r/ppp1bppp/2np1n2/6B1/2BNP3/2N5/PPP2PPP/R2QK2R b KQkq -
+r1bqk2r/ppp1bppp/3p1n2/6B1/2BnP3/2N5/PPP2PPP/R2QK2R w KQkq -
+r1bqk2r/ppp1bppp/3p1n2/6B1/2BQP3/2N5/PPP2PPP/R3K2R b KQkq -
+r1bqk2r/ppp1bpp1/3p1n1p/6B1/2BQP3/2N5/PPP2PPP/R3K2R w KQkq -
+r1bqk2r/ppp1bpp1/3p1n1p/8/2BQP2B/2N5/PPP2PPP/R3K2R b KQkq -
+r1bq1rk1/ppp1bpp1/3p1n1p/8/2BQP2B/2N5/PPP2PPP/R3K2R w KQ -
+r1bq1rk1/ppp1bpp1/3p1n1p/8/2BQP2B/2N5/PPP2PPP/2KR3R b - -
+r2q1rk1/pppbbpp1/3p1n1p/8/2BQP2B/2N5/PPP2PPP/2KR3R w - -
+r2q1rk1/pppbbpp1/3p1n1p/8/2BQP2B/2N5/PPP2PPP/2KRR3 b - -
+r2qr1k1/pppbbpp1/3p1n1p/8/2BQP2B/2N5/PPP2PPP/2KRR3 w - -
+r2qr1k1/pppbbpp1/3p1n1p/3N4/2BQP2B/8/PPP2PPP/2KRR3 b - -
+r2qr1k1/pppbbpp1/3p3p/3n4/2BQP2B/8/PPP2PPP/2KRR3 w - -
+r2qr1k1/pppbbpp1/3p3p/3Q4/2B1P2B/8/PPP2PPP/2KRR3 b - -
+r2qr1k1/pppb1pp1/3p3p/3Q4/2B1P2b/8/PPP2PPP/2KRR3 w - -
+r2qr1k1/pppb1Qp1/3p3p/8/2B1P2b/8/PPP2PPP/2KRR3 b - -
+r2qr2k/pppb1Qp1/3p3p/8/2B1P2b/8/PPP2PPP/2KRR3 w - -
+r2qr2k/pppb1Qp1/3p3p/4P3/2B4b/8/PPP2PPP/2KRR3 b - -
+r2q1r1k/pppb1Qp1/3p3p/4P3/2B4b/8/PPP2PPP/2KRR3 w - -
+r2q1r1k/pppb2p1/3p2Qp/4P3/2B4b/8/PPP2PPP/2KRR3 b - -
+r2q1r1k/pppb2p1/3p2Qp/4P3/2B5/8/PPP2bPP/2KRR3 w - -
+r2q1r1k/pppb2p1/3p2Qp/4P3/8/3B4/PPP2bPP/2KRR3 b - -
+r2q1rk1/pppb2p1/3p2Qp/4P3/8/3B4/PPP2bPP/2KRR3 w - -
+r2q1rk1/pppb2p1/3pP1Qp/8/8/3B4/PPP2bPP/2KRR3 b - -
+r2q1rk1/pppb2p1/3pP1Qp/8/8/3B4/PPP3PP/2KRb3 w - -
+r2q1rk1/pppb2pQ/3pP2p/8/8/3B4/PPP3PP/2KRb3 b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/ppp1pppp/8/3p4/4P3/8/PPPP1PPP/RNBQKBNR w KQkq d6
+rnbqkbnr/ppp1pppp/8/3P4/8/8/PPPP1PPP/RNBQKBNR b KQkq -
+rnb1kbnr/ppp1pppp/8/3q4/8/8/PPPP1PPP/RNBQKBNR w KQkq -
+rnb1kbnr/ppp1pppp/8/3q4/8/2N5/PPPP1PPP/R1BQKBNR b KQkq -
+rnb1kbnr/ppp1pppp/4q3/8/8/2N5/PPPP1PPP/R1BQKBNR w KQkq -
+rnb1kbnr/ppp1pppp/4q3/8/8/2N5/PPPPQPPP/R1B1KBNR b KQkq -
+rnb1kb1r/ppp1pppp/4qn2/8/8/2N5/PPPPQPPP/R1B1KBNR w KQkq -
+rnb1kb1r/ppp1pppp/4qn2/8/8/2N2N2/PPPPQPPP/R1B1KB1R b KQkq -
+rnb1kb1r/p1p1pppp/1p2qn2/8/8/2N2N2/PPPPQPPP/R1B1KB1R w KQkq -
+rnb1kb1r/p1p1pppp/1p2qn2/8/8/2NP1N2/PPP1QPPP/R1B1KB1R b KQkq -
+rnb1kb1r/p1p1ppp1/1p2qn1p/8/8/2NP1N2/PPP1QPPP/R1B1KB1R w KQkq -
+rnb1kb1r/p1p1ppp1/1p2Qn1p/8/8/2NP1N2/PPP2PPP/R1B1KB1R b KQkq -
+rn2kb1r/p1p1ppp1/1p2bn1p/8/8/2NP1N2/PPP2PPP/R1B1KB1R w KQkq -
+rn2kb1r/p1p1ppp1/1p2bn1p/8/8/2NP1N2/PPP1BPPP/R1B1K2R b KQkq -
+r3kb1r/p1pnppp1/1p2bn1p/8/8/2NP1N2/PPP1BPPP/R1B1K2R w KQkq -
+r3kb1r/p1pnppp1/1p2bn1p/8/8/2NP1N2/PPP1BPPP/R1B2RK1 b kq -
+r3kb1r/p1pnppp1/1p3n1p/8/6b1/2NP1N2/PPP1BPPP/R1B2RK1 w kq -
+r3kb1r/p1pnppp1/1p3n1p/8/5Bb1/2NP1N2/PPP1BPPP/R4RK1 b kq -
+2r1kb1r/p1pnppp1/1p3n1p/8/5Bb1/2NP1N2/PPP1BPPP/R4RK1 w k -
+2r1kb1r/p1pnppp1/1p3n1p/1N6/5Bb1/3P1N2/PPP1BPPP/R4RK1 b k -
+2r1kb1r/p1pnppp1/1p5p/1N1n4/5Bb1/3P1N2/PPP1BPPP/R4RK1 w k -
+2r1kb1r/p1pnppp1/1p5p/1N1n4/6b1/3P1NB1/PPP1BPPP/R4RK1 b k -
+2r1kb1r/2pnppp1/pp5p/1N1n4/6b1/3P1NB1/PPP1BPPP/R4RK1 w k -
+2r1kb1r/2pnppp1/pp5p/3n4/3N2b1/3P1NB1/PPP1BPPP/R4RK1 b k -
+2r1kb1r/2pnp1p1/pp3p1p/3n4/3N2b1/3P1NB1/PPP1BPPP/R4RK1 w k -
+2r1kb1r/2pnp1p1/pp3p1p/3n4/3N2b1/3P1NB1/PPP1BPPP/3R1RK1 b k -
+2r1kb1r/3np1p1/pp3p1p/2pn4/3N2b1/3P1NB1/PPP1BPPP/3R1RK1 w k c6
+2r1kb1r/3np1p1/pp3p1p/2pn4/6b1/1N1P1NB1/PPP1BPPP/3R1RK1 b k -
+2r1kb1r/3np1p1/pp3p1p/2p5/1n4b1/1N1P1NB1/PPP1BPPP/3R1RK1 w k -
+2r1kb1r/3np1p1/pp3p1p/2p5/1n1P2b1/1N3NB1/PPP1BPPP/3R1RK1 b k -
+2r1kb1r/3np1p1/pp3p1p/8/1npP2b1/1N3NB1/PPP1BPPP/3R1RK1 w k -
+2r1kb1r/3np1p1/pp3p1p/8/1npP2b1/5NB1/PPP1BPPP/2NR1RK1 b k -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/3P4/8/PPP1PPPP/RNBQKBNR b KQkq d3
+rnbqkbnr/ppp1pppp/8/3p4/3P4/8/PPP1PPPP/RNBQKBNR w KQkq d6
+rnbqkbnr/ppp1pppp/8/3p4/2PP4/8/PP2PPPP/RNBQKBNR b KQkq c3
+rnbqkbnr/ppp1pppp/8/8/2pP4/8/PP2PPPP/RNBQKBNR w KQkq -
+rnbqkbnr/ppp1pppp/8/8/2pPP3/8/PP3PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/ppp1pp1p/6p1/8/2pPP3/8/PP3PPP/RNBQKBNR w KQkq -
+rnbqkbnr/ppp1pp1p/6p1/8/2BPP3/8/PP3PPP/RNBQK1NR b KQkq -
+rnbqk1nr/ppp1ppbp/6p1/8/2BPP3/8/PP3PPP/RNBQK1NR w KQkq -
+rnbqk1nr/ppp1ppbp/6p1/8/2BPP3/8/PP2NPPP/RNBQK2R b KQkq -
+rnbqk2r/ppp1ppbp/5np1/8/2BPP3/8/PP2NPPP/RNBQK2R w KQkq -
+rnbqk2r/ppp1ppbp/5np1/8/2BPP3/2N5/PP2NPPP/R1BQK2R b KQkq -
+rnbq1rk1/ppp1ppbp/5np1/8/2BPP3/2N5/PP2NPPP/R1BQK2R w KQ -
+rnbq1rk1/ppp1ppbp/5np1/8/2BPP3/2N5/PP2NPPP/R1BQ1RK1 b - -
+rnbq1rk1/ppp2pbp/4pnp1/8/2BPP3/2N5/PP2NPPP/R1BQ1RK1 w - -
+rnbq1rk1/ppp2pbp/4pnp1/8/2BPP3/2N1B3/PP2NPPP/R2Q1RK1 b - -
+r1bq1rk1/pppn1pbp/4pnp1/8/2BPP3/2N1B3/PP2NPPP/R2Q1RK1 w - -
+r1bq1rk1/pppn1pbp/4pnp1/8/2BPP3/2N1BP2/PP2N1PP/R2Q1RK1 b - -
+r1bq1rk1/ppp2pbp/1n2pnp1/8/2BPP3/2N1BP2/PP2N1PP/R2Q1RK1 w - -
+r1bq1rk1/ppp2pbp/1n2pnp1/8/3PP3/2NBBP2/PP2N1PP/R2Q1RK1 b - -
+r1bq1rk1/1pp2pbp/1n2pnp1/p7/3PP3/2NBBP2/PP2N1PP/R2Q1RK1 w - a6
+r1bq1rk1/1pp2pbp/1n2pnp1/p7/3PP3/1PNBBP2/P3N1PP/R2Q1RK1 b - -
+r1bq1rk1/1p3pbp/1np1pnp1/p7/3PP3/1PNBBP2/P3N1PP/R2Q1RK1 w - -
+r1bq1rk1/1p3pbp/1np1pnp1/p7/3PP3/1PNBBP2/P3N1PP/R2Q1R1K b - -
+r1bq1rk1/1p1n1pbp/2p1pnp1/p7/3PP3/1PNBBP2/P3N1PP/R2Q1R1K w - -
+r1bq1rk1/1p1n1pbp/2p1pnp1/p7/3PP3/1PNBBP2/P2QN1PP/R4R1K b - -
+r1bq1rk1/3n1pbp/2p1pnp1/pp6/3PP3/1PNBBP2/P2QN1PP/R4R1K w - b6
+r1bq1rk1/3n1pbp/2p1pnp1/pp6/P2PP3/1PNBBP2/3QN1PP/R4R1K b - a3
+r1bq1rk1/3n1pbp/2p1pnp1/p7/Pp1PP3/1PNBBP2/3QN1PP/R4R1K w - -
+r1bq1rk1/3n1pbp/2p1pnp1/p7/Pp1PP3/1P1BBP2/N2QN1PP/R4R1K b - -
+r2q1rk1/3n1pbp/b1p1pnp1/p7/Pp1PP3/1P1BBP2/N2QN1PP/R4R1K w - -
+r2q1rk1/3n1pbp/b1p1pnp1/p7/Pp1PP3/1P1BBP2/3QN1PP/R1N2R1K b - -
+r2q1rk1/3n1pbp/2p1pnp1/p7/Pp1PP3/1P1bBP2/3QN1PP/R1N2R1K w - -
+r2q1rk1/3n1pbp/2p1pnp1/p7/Pp1PP3/1P1NBP2/3QN1PP/R4R1K b - -
+r4rk1/2qn1pbp/2p1pnp1/p7/Pp1PP3/1P1NBP2/3QN1PP/R4R1K w - -
+r4rk1/2qn1pbp/2p1pnp1/p7/Pp1PPB2/1P1N1P2/3QN1PP/R4R1K b - -
+r4rk1/3n1pbp/1qp1pnp1/p7/Pp1PPB2/1P1N1P2/3QN1PP/R4R1K w - -
+r4rk1/3n1pbp/1qp1pnp1/p7/Pp1PPB2/1P1N1P2/3QN1PP/2R2R1K b - -
+r4rk1/3n1pbp/1qp1p1p1/p6n/Pp1PPB2/1P1N1P2/3QN1PP/2R2R1K w - -
+r4rk1/3n1pbp/1qp1p1pB/p6n/Pp1PP3/1P1N1P2/3QN1PP/2R2R1K b - -
+r4rk1/3n1p1p/1qp1p1pb/p6n/Pp1PP3/1P1N1P2/3QN1PP/2R2R1K w - -
+r4rk1/3n1p1p/1qp1p1pQ/p6n/Pp1PP3/1P1N1P2/4N1PP/2R2R1K b - -
+r4rk1/3n1pnp/1qp1p1pQ/p7/Pp1PP3/1P1N1P2/4N1PP/2R2R1K w - -
+r4rk1/3n1pnp/1qp1p1pQ/p7/PpRPP3/1P1N1P2/4N1PP/5R1K b - -
+r4rk1/3n1pnp/1qp3pQ/p3p3/PpRPP3/1P1N1P2/4N1PP/5R1K w - -
+r4rk1/3n1pnp/1qp3pQ/p3P3/PpR1P3/1P1N1P2/4N1PP/5R1K b - -
+r3r1k1/3n1pnp/1qp3pQ/p3P3/PpR1P3/1P1N1P2/4N1PP/5R1K w - -
+r3r1k1/3n1pnp/1qp3pQ/p3P3/PpR1PP2/1P1N4/4N1PP/5R1K b - -
+r3r1k1/3n1pnp/2p3pQ/p3P3/PpR1PP2/1P1Nq3/4N1PP/5R1K w - -
+r3r1k1/3n1pnp/2p3pQ/p3P3/PpR1PP2/1P1Nq3/6PP/2N2R1K b - -
+r3r1k1/5pnp/1np3pQ/p3P3/PpR1PP2/1P1Nq3/6PP/2N2R1K w - -
+r3r1k1/5pnp/1np3pQ/p3P3/PpR1PP2/1P1Nq3/6PP/2N1R2K b - -
+r3r1k1/5pnp/2p3pQ/p3P3/Ppn1PP2/1P1Nq3/6PP/2N1R2K w - -
+r3r1k1/5pnp/2p3pQ/p3P3/Ppn1PP2/1P1NR3/6PP/2N4K b - -
+r3r1k1/5pnp/2p3pQ/p3P3/Pp2PP2/1P1Nn3/6PP/2N4K w - -
+r3r1k1/5pnp/2p3p1/p3P3/Pp2PP2/1P1Nn2Q/6PP/2N4K b - -
+r3r1k1/5pnp/2p3p1/p3P3/Pp2PP2/1P1N3Q/6PP/2Nn3K w - -
+r3r1k1/5pnp/2p3p1/p3P3/Pp2PP2/1P1N1Q2/6PP/2Nn3K b - -
+r3r1k1/5pnp/2p3p1/p3P3/Pp2PP2/1PnN1Q2/6PP/2N4K w - -
+r3r1k1/5pnp/2p3p1/p3PP2/Pp2P3/1PnN1Q2/6PP/2N4K b - -
+r3r1k1/5pnp/2p5/p3Pp2/Pp2P3/1PnN1Q2/6PP/2N4K w - -
+r3r1k1/5pnp/2p5/p3PP2/Pp6/1PnN1Q2/6PP/2N4K b - -
+3rr1k1/5pnp/2p5/p3PP2/Pp6/1PnN1Q2/6PP/2N4K w - -
+3rr1k1/5pnp/2p5/p3PP2/Pp6/1PnN1Q1P/6P1/2N4K b - -
+3rr1k1/5pnp/8/p1p1PP2/Pp6/1PnN1Q1P/6P1/2N4K w - -
+3rr1k1/5pnp/5P2/p1p1P3/Pp6/1PnN1Q1P/6P1/2N4K b - -
+3rr1k1/5p1p/4nP2/p1p1P3/Pp6/1PnN1Q1P/6P1/2N4K w - -
+3rr1k1/5p1p/4nP2/p1N1P3/Pp6/1Pn2Q1P/6P1/2N4K b - -
+3rr2k/5p1p/4nP2/p1N1P3/Pp6/1Pn2Q1P/6P1/2N4K w - -
+3rr2k/5p1p/4nP2/p1N1P3/Pp6/1PnN1Q1P/6P1/7K b - -
+3r2rk/5p1p/4nP2/p1N1P3/Pp6/1PnN1Q1P/6P1/7K w - -
+3r2rk/5p1p/4NP2/p3P3/Pp6/1PnN1Q1P/6P1/7K b - -
+3r2rk/7p/4pP2/p3P3/Pp6/1PnN1Q1P/6P1/7K w - -
+3r2rk/7p/4pP2/p3P3/Pp3N2/1Pn2Q1P/6P1/7K b - -
+4r1rk/7p/4pP2/p3P3/Pp3N2/1Pn2Q1P/6P1/7K w - -
+4r1rk/5P1p/4p3/p3P3/Pp3N2/1Pn2Q1P/6P1/7K b - -
+4rr1k/5P1p/4p3/p3P3/Pp3N2/1Pn2Q1P/6P1/7K w - -
+4Qr1k/7p/4p3/p3P3/Pp3N2/1Pn2Q1P/6P1/7K b - -
+4r2k/7p/4p3/p3P3/Pp3N2/1Pn2Q1P/6P1/7K w - -
+4r2k/7p/4p3/p3P3/Pp3NQ1/1Pn4P/6P1/7K b - -
+4r2k/7p/4p3/p3P3/Pp3NQ1/1P5P/n5P1/7K w - -
+4r2k/7p/4N3/p3P3/Pp4Q1/1P5P/n5P1/7K b - -
+6rk/7p/4N3/p3P3/Pp4Q1/1P5P/n5P1/7K w - -
+6rk/7p/4N3/p3PQ2/Pp6/1P5P/n5P1/7K b - -
+6rk/8/4N2p/p3PQ2/Pp6/1P5P/n5P1/7K w - -
+6rk/8/4NQ1p/p3P3/Pp6/1P5P/n5P1/7K b - -
+6r1/7k/4NQ1p/p3P3/Pp6/1P5P/n5P1/7K w - -
+5Nr1/7k/5Q1p/p3P3/Pp6/1P5P/n5P1/7K b - -
+5r2/7k/5Q1p/p3P3/Pp6/1P5P/n5P1/7K w - -
+5Q2/7k/7p/p3P3/Pp6/1P5P/n5P1/7K b - -
+5Q2/7k/7p/p3P3/Pp6/1P5P/6P1/2n4K w - -
+8/5Q1k/7p/p3P3/Pp6/1P5P/6P1/2n4K b - -
+7k/5Q2/7p/p3P3/Pp6/1P5P/6P1/2n4K w - -
+7k/5Q2/4P2p/p7/Pp6/1P5P/6P1/2n4K b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppp1ppp/8/4p3/4P3/8/PPPP1PPP/RNBQKBNR w KQkq e6
+rnbqkbnr/pppp1ppp/8/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R b KQkq -
+rnb1kbnr/pppp1ppp/5q2/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq -
+rnb1kbnr/pppp1ppp/5q2/4p3/3PP3/5N2/PPP2PPP/RNBQKB1R b KQkq d3
+rnb1kbnr/ppp2ppp/3p1q2/4p3/3PP3/5N2/PPP2PPP/RNBQKB1R w KQkq -
+rnb1kbnr/ppp2ppp/3p1q2/3Pp3/4P3/5N2/PPP2PPP/RNBQKB1R b KQkq -
+rn2kbnr/pppb1ppp/3p1q2/3Pp3/4P3/5N2/PPP2PPP/RNBQKB1R w KQkq -
+rn2kbnr/pppb1ppp/3p1q2/3Pp3/4P3/2N2N2/PPP2PPP/R1BQKB1R b KQkq -
+rn2kbnr/1ppb1ppp/p2p1q2/3Pp3/4P3/2N2N2/PPP2PPP/R1BQKB1R w KQkq -
+rn2kbnr/1ppb1ppp/p2p1q2/3Pp3/4P3/2N1BN2/PPP2PPP/R2QKB1R b KQkq -
+rn2k1nr/1ppbbppp/p2p1q2/3Pp3/4P3/2N1BN2/PPP2PPP/R2QKB1R w KQkq -
+rn2k1nr/1ppbbppp/p2p1q2/3Pp3/4P3/2NQBN2/PPP2PPP/R3KB1R b KQkq -
+rn2k2r/1ppbbppp/p2p1q1n/3Pp3/4P3/2NQBN2/PPP2PPP/R3KB1R w KQkq -
+rn2k2r/1ppbbppp/p2p1q1n/3Pp3/2Q1P3/2N1BN2/PPP2PPP/R3KB1R b KQkq -
+rn1bk2r/1ppb1ppp/p2p1q1n/3Pp3/2Q1P3/2N1BN2/PPP2PPP/R3KB1R w KQkq -
+rn1bk2r/1ppb1ppp/p2p1q1n/3Pp3/2Q1P3/2N1BN2/PPP2PPP/2KR1B1R b kq -
+rn1bk2r/1ppb1ppp/p2p1q2/3Pp3/2Q1P1n1/2N1BN2/PPP2PPP/2KR1B1R w kq -
+rn1bk2r/1ppb1ppp/p2p1q2/3Pp1B1/2Q1P1n1/2N2N2/PPP2PPP/2KR1B1R b kq -
+rn1bk2r/1ppb1ppp/p2p2q1/3Pp1B1/2Q1P1n1/2N2N2/PPP2PPP/2KR1B1R w kq -
+rn1Bk2r/1ppb1ppp/p2p2q1/3Pp3/2Q1P1n1/2N2N2/PPP2PPP/2KR1B1R b kq -
+rn1k3r/1ppb1ppp/p2p2q1/3Pp3/2Q1P1n1/2N2N2/PPP2PPP/2KR1B1R w - -
+rn1k3r/1ppb1ppp/p2p2q1/3Pp3/4P1n1/2N2N2/PPP1QPPP/2KR1B1R b - -
+rn1k3r/1ppb1ppp/p2p3q/3Pp3/4P1n1/2N2N2/PPP1QPPP/2KR1B1R w - -
+rn1k3r/1ppb1ppp/p2p3q/3Pp3/4P1n1/2N2N2/PPP1QPPP/1K1R1B1R b - -
+rn5r/1ppbkppp/p2p3q/3Pp3/4P1n1/2N2N2/PPP1QPPP/1K1R1B1R w - -
+rn5r/1ppbkppp/p2p3q/3Pp3/4P1n1/2N2N1P/PPP1QPP1/1K1R1B1R b - -
+rn5r/1ppbkppp/p2p1n1q/3Pp3/4P3/2N2N1P/PPP1QPP1/1K1R1B1R w - -
+rn5r/1ppbkppp/p2p1n1q/3Pp3/4P1P1/2N2N1P/PPP1QP2/1K1R1B1R b - g3
+rn5r/1ppbkp1p/p2p1n1q/3Pp1p1/4P1P1/2N2N1P/PPP1QP2/1K1R1B1R w - g6
+rn5r/1ppbkp1p/p2p1n1q/3Pp1p1/4P1P1/2N2N1P/PPP1QPB1/1K1R3R b - -
+rnr5/1ppbkp1p/p2p1n1q/3Pp1p1/4P1P1/2N2N1P/PPP1QPB1/1K1R3R w - -
+rnr5/1ppbkp1p/p2p1n1q/3Pp1p1/4P1P1/2N4P/PPPNQPB1/1K1R3R b - -
+rnr5/1p1bkp1p/p2p1n1q/2pPp1p1/4P1P1/2N4P/PPPNQPB1/1K1R3R w - c6
+rnr5/1p1bkp1p/p1Pp1n1q/4p1p1/4P1P1/2N4P/PPPNQPB1/1K1R3R b - -
+rnr5/1p2kp1p/p1bp1n1q/4p1p1/4P1P1/2N4P/PPPNQPB1/1K1R3R w - -
+rnr5/1p2kp1p/p1bp1n1q/4p1p1/4P1P1/2N1Q2P/PPPN1PB1/1K1R3R b - -
+rnr5/1p1nkp1p/p1bp3q/4p1p1/4P1P1/2N1Q2P/PPPN1PB1/1K1R3R w - -
+rnr5/1p1nkp1p/p1bp3q/4p1p1/4P1PP/2N1Q3/PPPN1PB1/1K1R3R b - -
+rnr5/3nkp1p/p1bp3q/1p2p1p1/4P1PP/2N1Q3/PPPN1PB1/1K1R3R w - b6
+rnr5/3nkp1p/p1bp3q/1p2p1P1/4P1P1/2N1Q3/PPPN1PB1/1K1R3R b - -
+rnr2q2/3nkp1p/p1bp4/1p2p1P1/4P1P1/2N1Q3/PPPN1PB1/1K1R3R w - -
+rnr2q2/3nkp1p/p1bp2P1/1p2p3/4P1P1/2N1Q3/PPPN1PB1/1K1R3R b - -
+rnr2q2/3nkp2/p1bp2p1/1p2p3/4P1P1/2N1Q3/PPPN1PB1/1K1R3R w - -
+rnr2q2/3nkp2/p1bp2p1/1p2p1Q1/4P1P1/2N5/PPPN1PB1/1K1R3R b - -
+rnr2q2/4kp2/p1bp1np1/1p2p1Q1/4P1P1/2N5/PPPN1PB1/1K1R3R w - -
+rnr2q2/4kp2/p1bp1np1/1p2p1Q1/4P1P1/2N2N2/PPP2PB1/1K1R3R b - -
+rnrq4/4kp2/p1bp1np1/1p2p1Q1/4P1P1/2N2N2/PPP2PB1/1K1R3R w - -
+rnrq4/4kp2/p1bp1np1/1p2N1Q1/4P1P1/2N5/PPP2PB1/1K1R3R b - -
+r1rq4/3nkp2/p1bp1np1/1p2N1Q1/4P1P1/2N5/PPP2PB1/1K1R3R w - -
+r1rq4/3nkp2/p1bp1nN1/1p4Q1/4P1P1/2N5/PPP2PB1/1K1R3R b - -
+r1rqk3/3n1p2/p1bp1nN1/1p4Q1/4P1P1/2N5/PPP2PB1/1K1R3R w - -
+r1rqk2R/3n1p2/p1bp1nN1/1p4Q1/4P1P1/2N5/PPP2PB1/1K1R4 b - -
+r1rqkn1R/5p2/p1bp1nN1/1p4Q1/4P1P1/2N5/PPP2PB1/1K1R4 w - -
+r1rqkR2/5p2/p1bp1nN1/1p4Q1/4P1P1/2N5/PPP2PB1/1K1R4 b - -
+r1rq1R2/3k1p2/p1bp1nN1/1p4Q1/4P1P1/2N5/PPP2PB1/1K1R4 w - -
+r1rR4/3k1p2/p1bp1nN1/1p4Q1/4P1P1/2N5/PPP2PB1/1K1R4 b - -
+r2r4/3k1p2/p1bp1nN1/1p4Q1/4P1P1/2N5/PPP2PB1/1K1R4 w - -
+r2r4/3k1p2/p1bp1nN1/1p3Q2/4P1P1/2N5/PPP2PB1/1K1R4 b - -
+r2r4/2k2p2/p1bp1nN1/1p3Q2/4P1P1/2N5/PPP2PB1/1K1R4 w - -
+r2r4/2k1Np2/p1bp1n2/1p3Q2/4P1P1/2N5/PPP2PB1/1K1R4 b - -
+r2r4/1bk1Np2/p2p1n2/1p3Q2/4P1P1/2N5/PPP2PB1/1K1R4 w - -
+r2r4/1bk1Np2/p2p1Q2/1p6/4P1P1/2N5/PPP2PB1/1K1R4 b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/3P4/8/PPP1PPPP/RNBQKBNR b KQkq d3
+rnbqkbnr/pppp1ppp/4p3/8/3P4/8/PPP1PPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppp1ppp/4p3/8/3P4/4P3/PPP2PPP/RNBQKBNR b KQkq -
+rnbqkbnr/pp1p1ppp/4p3/2p5/3P4/4P3/PPP2PPP/RNBQKBNR w KQkq c6
+rnbqkbnr/pp1p1ppp/4p3/2p5/3P4/2P1P3/PP3PPP/RNBQKBNR b KQkq -
+rnbqkbnr/pp3ppp/4p3/2pp4/3P4/2P1P3/PP3PPP/RNBQKBNR w KQkq d6
+rnbqkbnr/pp3ppp/4p3/2pp4/3P4/2PBP3/PP3PPP/RNBQK1NR b KQkq -
+rnbqkbnr/pp3ppp/4p3/3p4/2pP4/2PBP3/PP3PPP/RNBQK1NR w KQkq -
+rnbqkbnr/pp3ppp/4p3/3p4/2pP4/2P1P3/PPB2PPP/RNBQK1NR b KQkq -
+rnbqkbnr/p4ppp/4p3/1p1p4/2pP4/2P1P3/PPB2PPP/RNBQK1NR w KQkq b6
+rnbqkbnr/p4ppp/4p3/1p1p4/2pP1P2/2P1P3/PPB3PP/RNBQK1NR b KQkq f3
+r1bqkbnr/p4ppp/2n1p3/1p1p4/2pP1P2/2P1P3/PPB3PP/RNBQK1NR w KQkq -
+r1bqkbnr/p4ppp/2n1p3/1p1p4/2pP1P2/2P1PN2/PPB3PP/RNBQK2R b KQkq -
+r1bqkbnr/5ppp/2n1p3/pp1p4/2pP1P2/2P1PN2/PPB3PP/RNBQK2R w KQkq a6
+r1bqkbnr/5ppp/2n1p3/pp1p4/2pP1P2/2P1PN2/PPB3PP/RNBQ1RK1 b kq -
+r2qkbnr/1b3ppp/2n1p3/pp1p4/2pP1P2/2P1PN2/PPB3PP/RNBQ1RK1 w kq -
+r2qkbnr/1b3ppp/2n1p3/pp1p4/2pP1P2/2P1PN2/PPBN2PP/R1BQ1RK1 b kq -
+r2qkbnr/1b3ppp/2n1p3/p2p4/1ppP1P2/2P1PN2/PPBN2PP/R1BQ1RK1 w kq -
+r2qkbnr/1b3ppp/2n1p3/p2pN3/1ppP1P2/2P1P3/PPBN2PP/R1BQ1RK1 b kq -
+r2qk1nr/1b3ppp/2nbp3/p2pN3/1ppP1P2/2P1P3/PPBN2PP/R1BQ1RK1 w kq -
+r2qk1nr/1b3ppp/2nbp3/p2pN3/1ppP1P2/2P1PQ2/PPBN2PP/R1B2RK1 b kq -
+r2qk1nr/1b4pp/2nbp3/p2pNp2/1ppP1P2/2P1PQ2/PPBN2PP/R1B2RK1 w kq f6
+r2qk1nr/1b4pp/2nbp3/p2pNp1Q/1ppP1P2/2P1P3/PPBN2PP/R1B2RK1 b kq -
+r2qk1nr/1b5p/2nbp1p1/p2pNp1Q/1ppP1P2/2P1P3/PPBN2PP/R1B2RK1 w kq -
+r2qk1nr/1b5p/2nbp1N1/p2p1p1Q/1ppP1P2/2P1P3/PPBN2PP/R1B2RK1 b kq -
+r2qk2r/1b5p/2nbpnN1/p2p1p1Q/1ppP1P2/2P1P3/PPBN2PP/R1B2RK1 w kq -
+r2qk2r/1b5p/2nbpnN1/p2p1p2/1ppP1P2/2P1P2Q/PPBN2PP/R1B2RK1 b kq -
+r2qk1r1/1b5p/2nbpnN1/p2p1p2/1ppP1P2/2P1P2Q/PPBN2PP/R1B2RK1 w q -
+r2qk1r1/1b5p/2nbpn2/p2pNp2/1ppP1P2/2P1P2Q/PPBN2PP/R1B2RK1 b q -
+r3k1r1/1b2q2p/2nbpn2/p2pNp2/1ppP1P2/2P1P2Q/PPBN2PP/R1B2RK1 w q -
+r3k1r1/1b2q2p/2nbpn2/p2pNp2/1ppP1P2/2P1PN1Q/PPB3PP/R1B2RK1 b q -
+2kr2r1/1b2q2p/2nbpn2/p2pNp2/1ppP1P2/2P1PN1Q/PPB3PP/R1B2RK1 w - -
+2kr2r1/1b2q2p/2nbpn2/p2pNp2/1ppP1P2/2P1PN1Q/PPB3PP/1RB2RK1 b - -
+2kr4/1b2q1rp/2nbpn2/p2pNp2/1ppP1P2/2P1PN1Q/PPB3PP/1RB2RK1 w - -
+2kr4/1b2q1rp/2nbpn2/p2pNpN1/1ppP1P2/2P1P2Q/PPB3PP/1RB2RK1 b - -
+2k3r1/1b2q1rp/2nbpn2/p2pNpN1/1ppP1P2/2P1P2Q/PPB3PP/1RB2RK1 w - -
+2k3r1/1b2q1rp/2nbpn2/p2pNpN1/1ppP1P2/2P1P2Q/PPB2RPP/1RB3K1 b - -
+2k3r1/1b2q1rp/2nbp3/p2pNpN1/1ppPnP2/2P1P2Q/PPB2RPP/1RB3K1 w - -
+2k3r1/1b2q1rp/2nbp3/p2pNpN1/1ppPBP2/2P1P2Q/PP3RPP/1RB3K1 b - -
+2k3r1/1b2q1rp/2nbp3/p2pN1N1/1ppPpP2/2P1P2Q/PP3RPP/1RB3K1 w - -
+2k3r1/1b2q1rp/2nbQ3/p2pN1N1/1ppPpP2/2P1P3/PP3RPP/1RB3K1 b - -
+2k3r1/1b4rp/2nbq3/p2pN1N1/1ppPpP2/2P1P3/PP3RPP/1RB3K1 w - -
+2k3r1/1b4rp/2nbN3/p2pN3/1ppPpP2/2P1P3/PP3RPP/1RB3K1 b - -
+2k3r1/1b4rp/2n1N3/p2pb3/1ppPpP2/2P1P3/PP3RPP/1RB3K1 w - -
+2k3r1/1b4Np/2n5/p2pb3/1ppPpP2/2P1P3/PP3RPP/1RB3K1 b - -
+2k3r1/1b4bp/2n5/p2p4/1ppPpP2/2P1P3/PP3RPP/1RB3K1 w - -
+2k3r1/1b4bp/2n5/p2p4/1ppPpP2/2P1P3/PP1B1RPP/1R4K1 b - -
+2k3r1/1b5p/2n2b2/p2p4/1ppPpP2/2P1P3/PP1B1RPP/1R4K1 w - -
+2k3r1/1b5p/2n2b2/p2p4/1ppPpP2/2P1P1P1/PP1B1R1P/1R4K1 b - -
+2k3r1/1b6/2n2b2/p2p3p/1ppPpP2/2P1P1P1/PP1B1R1P/1R4K1 w - h6
+2k3r1/1b6/2n2b2/p2p3p/1ppPpP2/2P1P1P1/PP1B1R1P/5RK1 b - -
+2k3r1/1b6/2n2b2/p2p4/1ppPpP1p/2P1P1P1/PP1B1R1P/5RK1 w - -
+2k3r1/1b6/2n2b2/p2p4/1ppPpP1p/2P1P1P1/PP1B1RKP/5R2 b - -
+2k3r1/1b6/2n2b2/p2p4/1ppPpP2/2P1P1p1/PP1B1RKP/5R2 w - -
+2k3r1/1b6/2n2b2/p2p4/1ppPpP2/2P1P1P1/PP1B1RK1/5R2 b - -
+6r1/1bk5/2n2b2/p2p4/1ppPpP2/2P1P1P1/PP1B1RK1/5R2 w - -
+6r1/1bk5/2n2b2/p2p4/1ppPpP2/2P1P1P1/PP1B1RK1/7R b - -
+2b3r1/2k5/2n2b2/p2p4/1ppPpP2/2P1P1P1/PP1B1RK1/7R w - -
+2b3r1/2k5/2n2b1R/p2p4/1ppPpP2/2P1P1P1/PP1B1RK1/8 b - -
+6r1/2k5/2n2b1R/p2p4/1ppPpPb1/2P1P1P1/PP1B1RK1/8 w - -
+6r1/2k5/2n2R2/p2p4/1ppPpPb1/2P1P1P1/PP1B1RK1/8 b - -
+6r1/2k5/2n2R2/p2p4/1ppPpP2/2P1PbP1/PP1B1RK1/8 w - -
+6r1/2k5/2n2R2/p2p4/1ppPpP2/2P1PRP1/PP1B2K1/8 b - -
+6r1/2k5/2n2R2/p2p4/1ppP1P2/2P1PpP1/PP1B2K1/8 w - -
+6r1/2k5/2n2R2/p2p4/1ppP1P2/2P1PKP1/PP1B4/8 b - -
+6r1/2k5/2n2R2/p2p4/2pP1P2/1pP1PKP1/PP1B4/8 w - -
+6r1/2k5/2n2R2/p2p4/2pP1P2/1PP1PKP1/1P1B4/8 b - -
+6r1/2k5/2n2R2/p2p4/3P1P2/1pP1PKP1/1P1B4/8 w - -
+6r1/2k5/2n2R2/p2p4/3PPP2/1pP2KP1/1P1B4/8 b - -
+6r1/2k5/2n2R2/p7/3PpP2/1pP2KP1/1P1B4/8 w - -
+6r1/2k5/2n2R2/p7/3PKP2/1pP3P1/1P1B4/8 b - -
+6r1/2k5/2n2R2/8/p2PKP2/1pP3P1/1P1B4/8 w - -
+6r1/2k5/2n2R2/8/p2P1P2/1pP2KP1/1P1B4/8 b - -
+6r1/2k5/5R2/n7/p2P1P2/1pP2KP1/1P1B4/8 w - -
+6r1/2k5/8/n4R2/p2P1P2/1pP2KP1/1P1B4/8 b - -
+6r1/1nk5/8/5R2/p2P1P2/1pP2KP1/1P1B4/8 w - -
+6r1/1nk5/8/5R2/p2P1PP1/1pP2K2/1P1B4/8 b - -
+6r1/2k5/3n4/5R2/p2P1PP1/1pP2K2/1P1B4/8 w - -
+6r1/2k5/3n4/2R5/p2P1PP1/1pP2K2/1P1B4/8 b - -
+6r1/8/1k1n4/2R5/p2P1PP1/1pP2K2/1P1B4/8 w - -
+6r1/8/1k1n4/2R5/p1PP1PP1/1p3K2/1P1B4/8 b - -
+2r5/8/1k1n4/2R5/p1PP1PP1/1p3K2/1P1B4/8 w - -
+2R5/8/1k1n4/8/p1PP1PP1/1p3K2/1P1B4/8 b - -
+2n5/8/1k6/8/p1PP1PP1/1p3K2/1P1B4/8 w - -
+2n5/8/1k6/8/pBPP1PP1/1p3K2/1P6/8 b - -
+rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3
+rnbqkbnr/pppppp1p/6p1/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq -
+rnbqkbnr/pppppp1p/6p1/8/2P1P3/8/PP1P1PPP/RNBQKBNR b KQkq c3
+rnbqk1nr/ppppppbp/6p1/8/2P1P3/8/PP1P1PPP/RNBQKBNR w KQkq -
+rnbqk1nr/ppppppbp/6p1/8/2PPP3/8/PP3PPP/RNBQKBNR b KQkq d3
+rnbqk1nr/p1ppppbp/1p4p1/8/2PPP3/8/PP3PPP/RNBQKBNR w KQkq -
+rnbqk1nr/p1ppppbp/1p4p1/8/2PPP3/5N2/PP3PPP/RNBQKB1R b KQkq -
+rnbqk1nr/p2pppbp/1p4p1/2p5/2PPP3/5N2/PP3PPP/RNBQKB1R w KQkq c6
+rnbqk1nr/p2pppbp/1p4p1/2pP4/2P1P3/5N2/PP3PPP/RNBQKB1R b KQkq -
+rnbqk2r/p2pppbp/1p3np1/2pP4/2P1P3/5N2/PP3PPP/RNBQKB1R w KQkq -
+rnbqk2r/p2pppbp/1p3np1/2pP4/2P1P3/2N2N2/PP3PPP/R1BQKB1R b KQkq -
+rnbq1rk1/p2pppbp/1p3np1/2pP4/2P1P3/2N2N2/PP3PPP/R1BQKB1R w KQ -
+rnbq1rk1/p2pppbp/1p3np1/2pP4/2P1P3/2NB1N2/PP3PPP/R1BQK2R b KQ -
+rnbq1rk1/p2p1pbp/1p2pnp1/2pP4/2P1P3/2NB1N2/PP3PPP/R1BQK2R w KQ -
+rnbq1rk1/p2p1pbp/1p1Ppnp1/2p5/2P1P3/2NB1N2/PP3PPP/R1BQK2R b KQ -
+r1bq1rk1/p2p1pbp/1pnPpnp1/2p5/2P1P3/2NB1N2/PP3PPP/R1BQK2R w KQ -
+r1bq1rk1/p2p1pbp/1pnPpnp1/1Np5/2P1P3/3B1N2/PP3PPP/R1BQK2R b KQ -
+r2q1rk1/p2p1pbp/bpnPpnp1/1Np5/2P1P3/3B1N2/PP3PPP/R1BQK2R w KQ -
+r2q1rk1/p1Np1pbp/bpnPpnp1/2p5/2P1P3/3B1N2/PP3PPP/R1BQK2R b KQ -
+r2q1rk1/pbNp1pbp/1pnPpnp1/2p5/2P1P3/3B1N2/PP3PPP/R1BQK2R w KQ -
+N2q1rk1/pb1p1pbp/1pnPpnp1/2p5/2P1P3/3B1N2/PP3PPP/R1BQK2R b KQ -
+q4rk1/pb1p1pbp/1pnPpnp1/2p5/2P1P3/3B1N2/PP3PPP/R1BQK2R w KQ -
+q4rk1/pb1p1pbp/1pnPpnp1/2p5/2P1P3/3B1N2/PP3PPP/R1BQ1RK1 b - -
+q4rk1/pb1p1pbp/1p1Ppnp1/2p5/2PnP3/3B1N2/PP3PPP/R1BQ1RK1 w - -
+q4rk1/pb1p1pbp/1p1Ppnp1/2p1N3/2PnP3/3B4/PP3PPP/R1BQ1RK1 b - -
+q2r2k1/pb1p1pbp/1p1Ppnp1/2p1N3/2PnP3/3B4/PP3PPP/R1BQ1RK1 w - -
+q2r2k1/pb1p1pbp/1p1Ppnp1/2p1N3/2PnP3/3B1P2/PP4PP/R1BQ1RK1 b - -
+q2rn1k1/pb1p1pbp/1p1Pp1p1/2p1N3/2PnP3/3B1P2/PP4PP/R1BQ1RK1 w - -
+q2rn1k1/pb1p1pbp/1p1Pp1p1/2p1N3/Q1PnP3/3B1P2/PP4PP/R1B2RK1 b - -
+q2rn1k1/pb1p1p1p/1p1Pp1p1/2p1b3/Q1PnP3/3B1P2/PP4PP/R1B2RK1 w - -
+q2rn1k1/pb1p1p1p/1p1Pp1p1/2p1b3/Q1PnPP2/3B4/PP4PP/R1B2RK1 b - -
+q2rn1k1/pb1p1p1p/1p1bp1p1/2p5/Q1PnPP2/3B4/PP4PP/R1B2RK1 w - -
+q2rn1k1/pb1p1p1p/1p1bp1p1/2p2P2/Q1PnP3/3B4/PP4PP/R1B2RK1 b - -
+q2rn1k1/pb1p1p1p/1p1b2p1/2p2p2/Q1PnP3/3B4/PP4PP/R1B2RK1 w - -
+q2rn1k1/pb1p1p1p/1p1b2p1/2p2P2/Q1Pn4/3B4/PP4PP/R1B2RK1 b - -
+q2rn1k1/p2p1p1p/1p1b2p1/2p2P2/Q1Pn4/3B4/PP4bP/R1B2RK1 w - -
+q2rn1k1/p2p1p1p/1p1b2P1/2p5/Q1Pn4/3B4/PP4bP/R1B2RK1 b - -
+q2rn1k1/p2p1p1p/1p1b2P1/2p5/Q1Pn4/3B4/PP5P/R1B2bK1 w - -
+q2rn1k1/p2p1p1P/1p1b4/2p5/Q1Pn4/3B4/PP5P/R1B2bK1 b - -
+q2rn2k/p2p1p1P/1p1b4/2p5/Q1Pn4/3B4/PP5P/R1B2bK1 w - -
+q2rn2k/p2p1p1P/1p1b4/2p5/2Pn4/3B4/PPQ4P/R1B2bK1 b - -
+q2rn2k/p2p1p1P/1p1b4/2p5/2P5/3B4/PPn4P/R1B2bK1 w - -
+\.
+
+create temp table bench_position as
+    select fen::board as fen
+    from bench_fen, generate_series(1, :rows / (select count(*) from bench_fen));
+vacuum analyze bench_position;
@@ -0,0 +1,36 @@
+-- on disk size of boards: average datum size, heap and index sizes.
+-- Version 0 boards (with orig_fen) were sizeof(Board) 120 + pieces with a
+-- 4 byte header, 120-136 bytes each; board_version() shows what is stored.
+--
+-- Before and after dropping orig_fen, for the 999716 rows below. Datum
+-- sizes follow from the two layouts; heap pages are counted by filling 8kB
+-- pages with the tuple sizes (24 byte header, maxaligned, 4 byte line
+-- pointer), not read from a server:
+--
+--                      avg datum   min   max   heap pages    heap
+--   orig_fen, PLAIN       132.09   121   136        20180   158MB
+--   no orig_fen, MAIN      25.09    14    29         6966    54MB
+--
+-- A btree leaf entry drops from 146.5 to 40.9 bytes on average before
+-- deduplication, which folds the 586 copies of each position. The hash
+-- index stores 4 byte hash codes either way.
+--
+-- usage: psql -X -f bench/storage.sql
+
+\set rows 1000000
+\timing on
+set client_min_messages = warning;
+
+\ir positions.sql
+
+create index bench_position_btree on bench_position using btree(fen);
+create index bench_position_hash on bench_position using hash(fen);
+
+select
+     avg(pg_column_size(fen))::numeric(6,2)                         as avg_datum
+    ,min(pg_column_size(fen))                                       as min_datum
+    ,max(pg_column_size(fen))                                       as max_datum
+    ,pg_size_pretty(pg_relation_size('bench_position'))             as heap
+    ,pg_size_pretty(pg_relation_size('bench_position_btree'))       as btree
+    ,pg_size_pretty(pg_relation_size('bench_position_hash'))        as hash
+from bench_position;
@@ -30,6 +30,8 @@ CREATE FUNCTION side_eq(side, side)
 RETURNS bool LANGUAGE internal IMMUTABLE as 'chareq';
 CREATE FUNCTION side_ne(side, side)
 RETURNS bool LANGUAGE internal IMMUTABLE as 'charne';
+CREATE FUNCTION hash_side(side)
+RETURNS integer LANGUAGE internal IMMUTABLE AS 'hashchar';
 CREATE FUNCTION "not"(side)
 RETURNS side AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
 
@@ -64,9 +66,17 @@ RETURNS pindex AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
 CREATE FUNCTION pindex_out(pindex)
 RETURNS cstring AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
 
+CREATE FUNCTION pindex_recv(internal)
+RETURNS pindex AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION pindex_send(pindex)
+RETURNS bytea LANGUAGE internal IMMUTABLE STRICT AS 'int2send';
+
 CREATE TYPE pindex(
      INPUT          = pindex_in
     ,OUTPUT         = pindex_out
+    ,RECEIVE        = pindex_recv
+    ,SEND           = pindex_send
     ,LIKE           = int2
 );
 
@@ -167,6 +177,344 @@ DEFAULT FOR TYPE pindex USING hash AS
 OPERATOR        1       = ,
 FUNCTION        1       hash_pindex(pindex);
 
+/*}}}*/
+/****************************************************************************
+-- material : piece counts of both sides, 'KRPkr'
+ ****************************************************************************/
+/*{{{*/
+CREATE FUNCTION material_in(cstring)
+RETURNS material AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION material_out(material)
+RETURNS cstring AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION material_recv(internal)
+RETURNS material AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION material_send(material)
+RETURNS bytea LANGUAGE internal IMMUTABLE STRICT AS 'int8send';
+
+CREATE TYPE material(
+     INPUT          = material_in
+    ,OUTPUT         = material_out
+    ,RECEIVE        = material_recv
+    ,SEND           = material_send
+    ,LIKE           = int8
+);
+
+CREATE FUNCTION material_eq(material, material)
+RETURNS boolean LANGUAGE internal IMMUTABLE as 'int8eq';
+CREATE FUNCTION material_ne(material, material)
+RETURNS boolean LANGUAGE internal IMMUTABLE as 'int8ne';
+CREATE FUNCTION material_lt(material, material)
+RETURNS boolean LANGUAGE internal IMMUTABLE as 'int8lt';
+CREATE FUNCTION material_le(material, material)
+RETURNS boolean LANGUAGE internal IMMUTABLE as 'int8le';
+CREATE FUNCTION material_gt(material, material)
+RETURNS boolean LANGUAGE internal IMMUTABLE as 'int8gt';
+CREATE FUNCTION material_ge(material, material)
+RETURNS boolean LANGUAGE internal IMMUTABLE as 'int8ge';
+CREATE FUNCTION material_cmp(material, material)
+RETURNS integer LANGUAGE internal IMMUTABLE AS 'btint8cmp';
+CREATE FUNCTION hash_material(material)
+RETURNS integer LANGUAGE internal IMMUTABLE AS 'hashint8';
+CREATE FUNCTION hash_material_extended(material, int8)
+RETURNS int8 LANGUAGE internal IMMUTABLE AS 'hashint8extended';
+
+-- at least the pieces of the right side: material @> 'KRkr'
+CREATE FUNCTION material_contains(material, material)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION material_contained(material, material)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+-- white minus black in pawns (P=1, N=B=3, R=5, Q=9)
+CREATE FUNCTION imbalance(material)
+RETURNS int AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+-- imbalance(material) <= n and >= n as operators: material #>= 3
+CREATE FUNCTION material_imbalance_le(material, int)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION material_imbalance_ge(material, int)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR = (
+    LEFTARG = material,
+    RIGHTARG = material,
+    PROCEDURE = material_eq,
+    COMMUTATOR = '=',
+    NEGATOR = '<>',
+    RESTRICT = eqsel,
+    JOIN = eqjoinsel,
+    HASHES, MERGES
+);
+
+CREATE OPERATOR <> (
+    LEFTARG = material,
+    RIGHTARG = material,
+    PROCEDURE = material_ne,
+    COMMUTATOR = '<>',
+    NEGATOR = '=',
+    RESTRICT = neqsel,
+    JOIN = neqjoinsel
+);
+
+CREATE OPERATOR < (
+  LEFTARG = material,
+  RIGHTARG = material,
+  PROCEDURE = material_lt,
+  COMMUTATOR = > ,
+  NEGATOR = >= ,
+  RESTRICT = scalarltsel,
+  JOIN = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+  LEFTARG = material,
+  RIGHTARG = material,
+  PROCEDURE = material_le,
+  COMMUTATOR = >= ,
+  NEGATOR = > ,
+  RESTRICT = scalarltsel,
+  JOIN = scalarltjoinsel
+);
+
+CREATE OPERATOR > (
+  LEFTARG = material,
+  RIGHTARG = material,
+  PROCEDURE = material_gt,
+  COMMUTATOR = < ,
+  NEGATOR = <= ,
+  RESTRICT = scalargtsel,
+  JOIN = scalargtjoinsel
+);
+
+CREATE OPERATOR >= (
+  LEFTARG = material,
+  RIGHTARG = material,
+  PROCEDURE = material_ge,
+  COMMUTATOR = <= ,
+  NEGATOR = < ,
+  RESTRICT = scalargtsel,
+  JOIN = scalargtjoinsel
+);
+
+CREATE OPERATOR #<= (
+    LEFTARG = material,
+    RIGHTARG = int,
+    PROCEDURE = material_imbalance_le,
+    RESTRICT = matchingsel,
+    JOIN = matchingjoinsel
+);
+
+CREATE OPERATOR #>= (
+    LEFTARG = material,
+    RIGHTARG = int,
+    PROCEDURE = material_imbalance_ge,
+    RESTRICT = matchingsel,
+    JOIN = matchingjoinsel
+);
+
+CREATE OPERATOR @> (
+  LEFTARG = material,
+  RIGHTARG = material,
+  PROCEDURE = material_contains,
+  COMMUTATOR = <@ ,
+  RESTRICT = contsel,
+  JOIN = contjoinsel
+);
+
+CREATE OPERATOR <@ (
+  LEFTARG = material,
+  RIGHTARG = material,
+  PROCEDURE = material_contained,
+  COMMUTATOR = @> ,
+  RESTRICT = contsel,
+  JOIN = contjoinsel
+);
+
+CREATE OPERATOR CLASS btree_material_ops
+DEFAULT FOR TYPE material USING btree
+AS
+        OPERATOR        1       <  ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       =  ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       >  ,
+        FUNCTION        1       material_cmp(material, material);
+
+CREATE OPERATOR CLASS hash_material_ops
+DEFAULT FOR TYPE material USING hash AS
+OPERATOR        1       = ,
+FUNCTION        1       hash_material(material),
+FUNCTION        2       hash_material_extended(material, int8);
+
+/*}}}*/
+/****************************************************************************
+-- pawnkey : pawns of both sides, '8/pp3ppp/8/8/8/8/PP3PPP/8'
+ ****************************************************************************/
+/*{{{*/
+CREATE FUNCTION pawnkey_in(cstring)
+RETURNS pawnkey AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION pawnkey_out(pawnkey)
+RETURNS cstring AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION pawnkey_recv(internal)
+RETURNS pawnkey AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION pawnkey_send(pawnkey)
+RETURNS bytea AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE TYPE pawnkey(
+    INPUT          = pawnkey_in,
+    OUTPUT         = pawnkey_out,
+    RECEIVE        = pawnkey_recv,
+    SEND           = pawnkey_send,
+    INTERNALLENGTH = 16,
+    ALIGNMENT      = double,
+    STORAGE        = PLAIN
+);
+
+CREATE FUNCTION pawnkey_eq(pawnkey, pawnkey)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION pawnkey_ne(pawnkey, pawnkey)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION pawnkey_lt(pawnkey, pawnkey)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION pawnkey_le(pawnkey, pawnkey)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION pawnkey_gt(pawnkey, pawnkey)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION pawnkey_ge(pawnkey, pawnkey)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION pawnkey_cmp(pawnkey, pawnkey)
+RETURNS integer AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION pawnkey_hash(pawnkey)
+RETURNS integer AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION pawnkey_hash_extended(pawnkey, int8)
+RETURNS int8 AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+-- pawn skeleton search: every pawn of the right side on the same square
+CREATE FUNCTION pawnkey_contains(pawnkey, pawnkey)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION pawnkey_contained(pawnkey, pawnkey)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR = (
+    LEFTARG = pawnkey,
+    RIGHTARG = pawnkey,
+    PROCEDURE = pawnkey_eq,
+    COMMUTATOR = '=',
+    NEGATOR = '<>',
+    RESTRICT = eqsel,
+    JOIN = eqjoinsel,
+    HASHES, MERGES
+);
+
+CREATE OPERATOR <> (
+    LEFTARG = pawnkey,
+    RIGHTARG = pawnkey,
+    PROCEDURE = pawnkey_ne,
+    COMMUTATOR = '<>',
+    NEGATOR = '=',
+    RESTRICT = neqsel,
+    JOIN = neqjoinsel
+);
+
+CREATE OPERATOR < (
+  LEFTARG = pawnkey,
+  RIGHTARG = pawnkey,
+  PROCEDURE = pawnkey_lt,
+  COMMUTATOR = > ,
+  NEGATOR = >= ,
+  RESTRICT = scalarltsel,
+  JOIN = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+  LEFTARG = pawnkey,
+  RIGHTARG = pawnkey,
+  PROCEDURE = pawnkey_le,
+  COMMUTATOR = >= ,
+  NEGATOR = > ,
+  RESTRICT = scalarltsel,
+  JOIN = scalarltjoinsel
+);
+
+CREATE OPERATOR > (
+  LEFTARG = pawnkey,
+  RIGHTARG = pawnkey,
+  PROCEDURE = pawnkey_gt,
+  COMMUTATOR = < ,
+  NEGATOR = <= ,
+  RESTRICT = scalargtsel,
+  JOIN = scalargtjoinsel
+);
+
+CREATE OPERATOR >= (
+  LEFTARG = pawnkey,
+  RIGHTARG = pawnkey,
+  PROCEDURE = pawnkey_ge,
+  COMMUTATOR = <= ,
+  NEGATOR = < ,
+  RESTRICT = scalargtsel,
+  JOIN = scalargtjoinsel
+);
+
+CREATE OPERATOR @> (
+  LEFTARG = pawnkey,
+  RIGHTARG = pawnkey,
+  PROCEDURE = pawnkey_contains,
+  COMMUTATOR = <@ ,
+  RESTRICT = contsel,
+  JOIN = contjoinsel
+);
+
+CREATE OPERATOR <@ (
+  LEFTARG = pawnkey,
+  RIGHTARG = pawnkey,
+  PROCEDURE = pawnkey_contained,
+  COMMUTATOR = @> ,
+  RESTRICT = contsel,
+  JOIN = contjoinsel
+);
+
+CREATE OPERATOR CLASS btree_pawnkey_ops
+DEFAULT FOR TYPE pawnkey USING btree
+AS
+        OPERATOR        1       <  ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       =  ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       >  ,
+        FUNCTION        1       pawnkey_cmp(pawnkey, pawnkey);
+
+CREATE OPERATOR CLASS hash_pawnkey_ops
+DEFAULT FOR TYPE pawnkey USING hash AS
+OPERATOR        1       = ,
+FUNCTION        1       pawnkey_hash(pawnkey),
+FUNCTION        2       pawnkey_hash_extended(pawnkey, int8);
+
+CREATE FUNCTION pawnkey_gin_extract_value(pawnkey, internal, internal)
+RETURNS internal AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION pawnkey_gin_extract_query(pawnkey, internal, int2, internal, internal, internal, internal)
+RETURNS internal AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION pawnkey_gin_consistent(internal, int2, pawnkey, int4, internal, internal, internal, internal)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION pawnkey_gin_triconsistent(internal, int2, pawnkey, int4, internal, internal, internal)
+RETURNS "char" AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+-- one key per pawn; = and <@ are rechecked
+CREATE OPERATOR CLASS gin_pawnkey_ops
+DEFAULT FOR TYPE pawnkey USING gin AS
+OPERATOR        2       @> (pawnkey, pawnkey),
+OPERATOR        3       <@ (pawnkey, pawnkey),
+OPERATOR        4       = (pawnkey, pawnkey),
+FUNCTION        1       btint2cmp(int2, int2),
+FUNCTION        2       pawnkey_gin_extract_value(pawnkey, internal, internal),
+FUNCTION        3       pawnkey_gin_extract_query(pawnkey, internal, int2, internal, internal, internal, internal),
+FUNCTION        4       pawnkey_gin_consistent(internal, int2, pawnkey, int4, internal, internal, internal, internal),
+FUNCTION        6       pawnkey_gin_triconsistent(internal, int2, pawnkey, int4, internal, internal, internal),
+STORAGE         int2;
+
 /*}}}*/
 /****************************************************************************
 -- square:
@@ -182,9 +530,19 @@ RETURNS cstring
 AS '$libdir/chess_index'
 LANGUAGE C IMMUTABLE STRICT;
 
+CREATE FUNCTION square_recv(internal)
+RETURNS square
+AS '$libdir/chess_index'
+LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION square_send(square)
+RETURNS bytea LANGUAGE internal IMMUTABLE STRICT AS 'charsend';
+
 CREATE TYPE square(
   INPUT          = square_in,
   OUTPUT         = square_out,
+  RECEIVE        = square_recv,
+  SEND           = square_send,
   LIKE           = char,
 	INTERNALLENGTH = 1, 
 	ALIGNMENT      = char,
@@ -360,9 +718,17 @@ RETURNS piecesquare AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
 CREATE FUNCTION piecesquare_out(piecesquare)
 RETURNS cstring AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
 
+CREATE FUNCTION piecesquare_recv(internal)
+RETURNS piecesquare AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION piecesquare_send(piecesquare)
+RETURNS bytea LANGUAGE internal IMMUTABLE STRICT AS 'int2send';
+
 CREATE TYPE piecesquare(
      INPUT          = piecesquare_in
     ,OUTPUT         = piecesquare_out
+    ,RECEIVE        = piecesquare_recv
+    ,SEND           = piecesquare_send
     ,STORAGE        = PLAIN
     ,LIKE           = int2
 );
@@ -386,10 +752,25 @@ RETURNS board AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
 CREATE FUNCTION board_out(board)
 RETURNS cstring AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
 
+CREATE FUNCTION board_recv(internal)
+RETURNS board AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION board_send(board)
+RETURNS bytea AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+-- the standard statistics plus piece square, pcount, side to move and material
+-- frequencies for the board selectivity estimators
+CREATE FUNCTION board_typanalyze(internal)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C STRICT;
+
 CREATE TYPE board(
     INPUT          = board_in,
     OUTPUT         = board_out,
-    STORAGE        = PLAIN
+    RECEIVE        = board_recv,
+    SEND           = board_send,
+    ANALYZE        = board_typanalyze,
+    ALIGNMENT      = double,
+    STORAGE        = MAIN   -- inline, but small enough for 1 byte headers
 );
 
 CREATE FUNCTION pcount(board)
@@ -398,6 +779,14 @@ CREATE FUNCTION side(board)
 RETURNS side AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
 CREATE FUNCTION pieces(board, side)
 RETURNS pindex AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION material(board)
+RETURNS material AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION pawns(board)
+RETURNS pawnkey AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION castling(board)
+RETURNS text AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION piece_at(board, square)
+RETURNS piece AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
 
 CREATE FUNCTION board_eq(board, board)
 RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
@@ -413,8 +802,74 @@ CREATE FUNCTION board_ge(board, board)
 RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
 CREATE FUNCTION board_cmp(board, board)
 RETURNS int AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_sortsupport(internal)
+RETURNS void AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
 CREATE FUNCTION board_hash(board)
 RETURNS int AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_hash_extended(board, int8)
+RETURNS int8 AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION zobrist(board)
+RETURNS int8 AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_upgrade(board)
+RETURNS board AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_version(board)
+RETURNS int AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+-- legal moves with the position after each; promotion is null unless a pawn promotes
+CREATE FUNCTION moves(board, OUT "from" square, OUT "to" square, OUT promotion piece, OUT piece piece, OUT board board)
+RETURNS SETOF record AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT ROWS 30;
+CREATE FUNCTION legal_move_count(board)
+RETURNS int AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+-- leaf nodes of the legal move tree; divide gives them per move (in uci)
+CREATE FUNCTION perft(board, depth int)
+RETURNS int8 AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION perft_divide(board, depth int, OUT move text, OUT nodes int8)
+RETURNS SETOF record AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT ROWS 30;
+
+-- attack maps are int8 masks in square order: bit 0 is a1, bit 63 is h8
+CREATE FUNCTION attacks(board, side)
+RETURNS int8 AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION attackers(board, square, side)
+RETURNS int8 AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION in_check(board)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION pinned(board, side)
+RETURNS int8 AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION hanging(board, side)
+RETURNS int8 AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+-- a move in uci (e2e4, e7e8q) or san (e4, Nbd7, exd5, e8=Q, O-O)
+CREATE FUNCTION board_apply(board, text)
+RETURNS board AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+-- the board in its decoded, in-memory form. board_apply returns this form
+-- too, so chained applies and plpgsql variables skip decoding the board
+CREATE FUNCTION board_expand(board)
+RETURNS board AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+-- flip_colors is the same position from the other side: ranks flipped,
+-- colors, side to move, castling and enpassant swapped. mirror_files swaps
+-- the a and h files and drops castling rights. canonical is whichever of a
+-- board and its flip_colors has white to move, for indexing and grouping
+-- color reversed positions together
+CREATE FUNCTION flip_colors(board)
+RETURNS board AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION mirror_files(board)
+RETURNS board AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION canonical(board)
+RETURNS board AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+-- fens to boards in one call, nulls stay null
+CREATE FUNCTION boards_from_text(text[])
+RETURNS board[] AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+-- writes the board in the first column of query to a server side file, one
+-- per line, and returns the count. Boards have no move clocks so fen lines end
+-- in "0 1"; epd lines are the four fields. Needs pg_write_server_files.
+CREATE FUNCTION export_fen(query text, path text, epd boolean DEFAULT false)
+RETURNS int8 AS '$libdir/chess_index' LANGUAGE C VOLATILE STRICT;
+-- ply 0 is the starting board, then the position after each move
+CREATE FUNCTION replay(board, text[], OUT ply int, OUT position board)
+RETURNS SETOF record AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT ROWS 80;
+-- every position of every game in a pgn text. ply 0 is the starting board,
+-- taken from a FEN tag when there is one; move is the san that led to position
+CREATE FUNCTION pgn_positions(text, OUT game_no int, OUT ply int, OUT position board, OUT move text)
+RETURNS SETOF record AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT ROWS 1000;
 
 CREATE OPERATOR = (
     LEFTARG = board,
@@ -485,12 +940,243 @@ OPERATOR        2       <= ,
 OPERATOR        3       =  ,
 OPERATOR        4       >= ,
 OPERATOR        5       >  ,
-FUNCTION        1       board_cmp(board, board);
+FUNCTION        1       board_cmp(board, board),
+FUNCTION        2       board_sortsupport(internal);
 
 CREATE OPERATOR CLASS hash_board_ops
 DEFAULT FOR TYPE board USING hash AS
 OPERATOR        1       = ,
-FUNCTION        1       board_hash(board);
+FUNCTION        1       board_hash(board),
+FUNCTION        2       board_hash_extended(board, int8);
+
+-- planner estimates for the board operators below: the operator is run over
+-- the column's most common and histogram boards, and a containment none of
+-- them match is estimated from piece square frequencies. pcount and material
+-- use the board_typanalyze frequencies when the column has them
+CREATE FUNCTION board_contsel(internal, oid, internal, int4)
+RETURNS float8 AS '$libdir/chess_index' LANGUAGE C STABLE STRICT;
+CREATE FUNCTION board_containedsel(internal, oid, internal, int4)
+RETURNS float8 AS '$libdir/chess_index' LANGUAGE C STABLE STRICT;
+CREATE FUNCTION board_overlapsel(internal, oid, internal, int4)
+RETURNS float8 AS '$libdir/chess_index' LANGUAGE C STABLE STRICT;
+CREATE FUNCTION board_eqsel(internal, oid, internal, int4)
+RETURNS float8 AS '$libdir/chess_index' LANGUAGE C STABLE STRICT;
+CREATE FUNCTION board_lesel(internal, oid, internal, int4)
+RETURNS float8 AS '$libdir/chess_index' LANGUAGE C STABLE STRICT;
+CREATE FUNCTION board_gesel(internal, oid, internal, int4)
+RETURNS float8 AS '$libdir/chess_index' LANGUAGE C STABLE STRICT;
+CREATE FUNCTION board_joinsel(internal, oid, internal, int2, internal)
+RETURNS float8 AS '$libdir/chess_index' LANGUAGE C STABLE STRICT;
+
+-- piece square containment: fen @> '{Nf5,pe6}' has all, fen && '{Nf5,pe6}' has any
+CREATE FUNCTION board_contains(board, piecesquare[])
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_overlaps(board, piecesquare[])
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR @> (
+    LEFTARG = board,
+    RIGHTARG = piecesquare[],
+    PROCEDURE = board_contains,
+    RESTRICT = board_contsel,
+    JOIN = board_joinsel
+);
+
+CREATE OPERATOR && (
+    LEFTARG = board,
+    RIGHTARG = piecesquare[],
+    PROCEDURE = board_overlaps,
+    RESTRICT = board_overlapsel,
+    JOIN = board_joinsel
+);
+
+CREATE FUNCTION piecesquare_cmp(piecesquare, piecesquare)
+RETURNS integer LANGUAGE internal IMMUTABLE AS 'btint2cmp';
+CREATE FUNCTION board_gin_extract_value(board, internal, internal)
+RETURNS internal AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_gin_extract_query(piecesquare[], internal, int2, internal, internal, internal, internal)
+RETURNS internal AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_gin_consistent(internal, int2, piecesquare[], int4, internal, internal, internal, internal)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_gin_triconsistent(internal, int2, piecesquare[], int4, internal, internal, internal)
+RETURNS "char" AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR CLASS gin_board_ops
+DEFAULT FOR TYPE board USING gin AS
+OPERATOR        1       && (board, piecesquare[]),
+OPERATOR        2       @> (board, piecesquare[]),
+FUNCTION        1       piecesquare_cmp(piecesquare, piecesquare),
+FUNCTION        2       board_gin_extract_value(board, internal, internal),
+FUNCTION        3       board_gin_extract_query(piecesquare[], internal, int2, internal, internal, internal, internal),
+FUNCTION        4       board_gin_consistent(internal, int2, piecesquare[], int4, internal, internal, internal, internal),
+FUNCTION        6       board_gin_triconsistent(internal, int2, piecesquare[], int4, internal, internal, internal),
+STORAGE         piecesquare;
+
+-- sub-position search: fen @> pattern when every piece of pattern is on the
+-- same square in fen. state (side, castling, enpassant) is not compared.
+CREATE FUNCTION board_contains_board(board, board)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_contained_board(board, board)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR @> (
+    LEFTARG = board,
+    RIGHTARG = board,
+    PROCEDURE = board_contains_board,
+    COMMUTATOR = '<@',
+    RESTRICT = board_contsel,
+    JOIN = board_joinsel
+);
+
+CREATE OPERATOR <@ (
+    LEFTARG = board,
+    RIGHTARG = board,
+    PROCEDURE = board_contained_board,
+    COMMUTATOR = '@>',
+    RESTRICT = board_containedsel,
+    JOIN = board_joinsel
+);
+
+-- similarity: occupancy bits that differ per piece type, plus one for the side
+-- to move, each castling right and the enpassant square
+CREATE FUNCTION board_distance(board, board)
+RETURNS float8 AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR <-> (
+    LEFTARG = board,
+    RIGHTARG = board,
+    PROCEDURE = board_distance,
+    COMMUTATOR = '<->'
+);
+
+-- gist key: one 64 bit occupancy mask per piece type
+CREATE FUNCTION boardsig_in(cstring)
+RETURNS boardsig AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE FUNCTION boardsig_out(boardsig)
+RETURNS cstring AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE TYPE boardsig(
+    INPUT          = boardsig_in,
+    OUTPUT         = boardsig_out,
+    ALIGNMENT      = double,
+    STORAGE        = PLAIN
+);
+
+CREATE FUNCTION board_gist_consistent(internal, board, int2, oid, internal)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_gist_union(internal, internal)
+RETURNS boardsig AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_gist_compress(internal)
+RETURNS internal AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_gist_penalty(internal, internal, internal)
+RETURNS internal AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_gist_picksplit(internal, internal)
+RETURNS internal AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_gist_same(boardsig, boardsig, internal)
+RETURNS internal AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_gist_distance(internal, board, int2, oid, internal)
+RETURNS float8 AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR CLASS gist_board_ops
+DEFAULT FOR TYPE board USING gist AS
+OPERATOR        7       @> (board, board),
+OPERATOR        15      <-> (board, board) FOR ORDER BY pg_catalog.float_ops,
+FUNCTION        1       board_gist_consistent(internal, board, int2, oid, internal),
+FUNCTION        2       board_gist_union(internal, internal),
+FUNCTION        3       board_gist_compress(internal),
+FUNCTION        5       board_gist_penalty(internal, internal, internal),
+FUNCTION        6       board_gist_picksplit(internal, internal),
+FUNCTION        7       board_gist_same(boardsig, boardsig, internal),
+FUNCTION        8       board_gist_distance(internal, board, int2, oid, internal),
+STORAGE         boardsig;
+
+-- pcount(fen) <= n and >= n as operators, and exact material, for brin_board_ops
+CREATE FUNCTION board_pcount_le(board, int)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_pcount_ge(board, int)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_material_eq(board, material)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+CREATE OPERATOR #<= (
+    LEFTARG = board,
+    RIGHTARG = int,
+    PROCEDURE = board_pcount_le,
+    RESTRICT = board_lesel,
+    JOIN = board_joinsel
+);
+
+CREATE OPERATOR #>= (
+    LEFTARG = board,
+    RIGHTARG = int,
+    PROCEDURE = board_pcount_ge,
+    RESTRICT = board_gesel,
+    JOIN = board_joinsel
+);
+
+CREATE OPERATOR = (
+    LEFTARG = board,
+    RIGHTARG = material,
+    PROCEDURE = board_material_eq,
+    RESTRICT = board_eqsel,
+    JOIN = board_joinsel
+);
+
+CREATE FUNCTION board_brin_opcinfo(internal)
+RETURNS internal AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_brin_add_value(internal, internal, internal, internal)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_brin_consistent(internal, internal, internal)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+CREATE FUNCTION board_brin_union(internal, internal, internal)
+RETURNS boolean AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT;
+
+-- per block range: occupancy of each side, min/max pcount and a material bloom
+CREATE OPERATOR CLASS brin_board_ops
+DEFAULT FOR TYPE board USING brin AS
+OPERATOR        1       @> (board, piecesquare[]),
+OPERATOR        2       && (board, piecesquare[]),
+OPERATOR        3       @> (board, board),
+OPERATOR        4       #<= (board, int),
+OPERATOR        5       #>= (board, int),
+OPERATOR        6       = (board, material),
+FUNCTION        1       board_brin_opcinfo(internal),
+FUNCTION        2       board_brin_add_value(internal, internal, internal, internal),
+FUNCTION        3       board_brin_consistent(internal, internal, internal),
+FUNCTION        4       board_brin_union(internal, internal, internal);
+
+CREATE FUNCTION heatmap_transfn(internal, board)
+RETURNS internal AS '$libdir/chess_index' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE FUNCTION heatmap_invfn(internal, board)
+RETURNS internal AS '$libdir/chess_index' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE FUNCTION heatmap_combine(internal, internal)
+RETURNS internal AS '$libdir/chess_index' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE FUNCTION heatmap_serialize(internal)
+RETURNS bytea AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION heatmap_deserialize(bytea, internal)
+RETURNS internal AS '$libdir/chess_index' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION heatmap_final(internal)
+RETURNS int8[] AS '$libdir/chess_index' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+-- how often each piece stood on each square: int8[12][64], pieces in the
+-- order PNBRQKpnbrqk, squares a1=1 .. h8=64. runs in parallel and as a
+-- moving aggregate in windows
+CREATE AGGREGATE heatmap(board) (
+    SFUNC           = heatmap_transfn,
+    STYPE           = internal,
+    SSPACE          = 6152,
+    FINALFUNC       = heatmap_final,
+    COMBINEFUNC     = heatmap_combine,
+    SERIALFUNC      = heatmap_serialize,
+    DESERIALFUNC    = heatmap_deserialize,
+    MSFUNC          = heatmap_transfn,
+    MINVFUNC        = heatmap_invfn,
+    MSTYPE          = internal,
+    MSSPACE         = 6152,
+    MFINALFUNC      = heatmap_final,
+    PARALLEL        = SAFE
+);
 
 /*}}}*/
 /****************************************************************************
@@ -606,6 +1292,49 @@ LANGUAGE C IMMUTABLE STRICT;
 CREATE CAST (diagonal AS int4) WITH FUNCTION char_to_int(diagonal);
 /*}}}*/
 
+/****************************************************************************
+-- stats
+ ****************************************************************************/
+/*{{{*/
+-- calls, bytes and nanoseconds of board_in, board_out, board_hash, board_cmp
+-- and the gin, gist and brin board support functions. Counted while
+-- chess_index.track_stats is on, timed while chess_index.track_timing is on.
+-- shared sums every backend's finished transactions and needs chess_index in
+-- shared_preload_libraries.
+CREATE FUNCTION chess_index_stats(shared boolean DEFAULT false,
+    OUT function text, OUT calls int8, OUT bytes int8, OUT nanoseconds int8)
+RETURNS SETOF record AS '$libdir/chess_index' LANGUAGE C VOLATILE STRICT ROWS 7;
+CREATE FUNCTION chess_index_stats_reset(shared boolean DEFAULT false)
+RETURNS void AS '$libdir/chess_index' LANGUAGE C VOLATILE STRICT;
+REVOKE EXECUTE ON FUNCTION chess_index_stats_reset(boolean) FROM PUBLIC;
+/*}}}*/
+
+/****************************************************************************
+-- position interning
+ ****************************************************************************/
+/*{{{*/
+-- position_id gives each distinct board an int8 id, adding it here the first
+-- time. With chess_index in shared_preload_libraries committed ids are also
+-- cached in shared memory (up to chess_index.intern_max_positions), so
+-- repeated positions skip this table. The cache is keyed by database and
+-- extension oid as well, so each database and each CREATE EXTENSION has its own
+-- ids; entries of a dropped extension keep their slots until restart. Rows are
+-- never reused: deleting or truncating them leaves stale ids in the cache until
+-- restart.
+CREATE TABLE chess_index_positions (
+    id          int8 GENERATED ALWAYS AS IDENTITY PRIMARY KEY,
+    position    board NOT NULL UNIQUE
+);
+SELECT pg_catalog.pg_extension_config_dump('chess_index_positions', '');
+SELECT pg_catalog.pg_extension_config_dump('chess_index_positions_id_seq', '');
+
+CREATE FUNCTION position_id(board)
+RETURNS int8 AS '$libdir/chess_index' LANGUAGE C VOLATILE STRICT;
+-- null when there is no such id
+CREATE FUNCTION position_of(int8)
+RETURNS board AS '$libdir/chess_index' LANGUAGE C STABLE STRICT;
+/*}}}*/
+
 /****************************************************************************
 -- sql functions
  ****************************************************************************/
@@ -645,8 +1374,82 @@ RETURNS text AS $$
 select pretty($1::text, $2, $3)
 $$ LANGUAGE SQL IMMUTABLE STRICT;
 
+-- swaps the letters only; flip_colors(board) is the color reversed position
 CREATE OR REPLACE FUNCTION invert(board)
 RETURNS text AS $$
     select translate($1::text, 'KQRBNPkqrbnpwb', 'kqrbnpKQRBNPbw')
 $$ LANGUAGE SQL IMMUTABLE STRICT;
+
+-- rewrite boards stored in an older format and allow short headers.
+-- returns the number of rows rewritten; vacuum full / reindex afterwards
+CREATE OR REPLACE FUNCTION upgrade_boards(tbl regclass, col name)
+RETURNS bigint AS $$
+DECLARE
+    n bigint;
+BEGIN
+    EXECUTE format('ALTER TABLE %s ALTER COLUMN %I SET STORAGE MAIN', tbl, col);
+    EXECUTE format('UPDATE %s SET %I = board_upgrade(%I) WHERE board_version(%I) < 1', tbl, col, col, col);
+    GET DIAGNOSTICS n = ROW_COUNT;
+    RETURN n;
+END;
+$$ LANGUAGE plpgsql;
+
+-- equality opclasses for the contrib bloom access method, so one index covers
+-- any mix of derived attributes:
+--   create index on games using bloom (side(fen), castling(fen), material(fen), piece_at(fen, 'e4'))
+-- made with the extension when bloom is already installed, otherwise call this
+-- after CREATE EXTENSION bloom; opclasses made then are added to chess_index so
+-- they go with DROP EXTENSION and are left out of pg_dump like the rest.
+-- castling() is text, covered by bloom's own text_ops. bloom takes at most 32
+-- columns, so full occupancy (a piece_at column per square) does not fit in one
+-- index; pick the squares the queries ask about.
+CREATE OR REPLACE FUNCTION create_bloom_opclasses()
+RETURNS void AS $$
+DECLARE
+    t record;
+    o record;
+BEGIN
+    FOR t IN SELECT * FROM (VALUES
+         ('board', 'board_hash')
+        ,('side', 'hash_side')
+        ,('material', 'hash_material')
+        ,('pawnkey', 'pawnkey_hash')
+        ,('pindex', 'hash_pindex')
+        ,('piece', 'hash_square')
+        ,('square', 'hash_square')
+    ) AS v(typ, fn) LOOP
+        IF NOT EXISTS (SELECT 1 FROM pg_opclass c JOIN pg_am a ON a.oid = c.opcmethod
+                WHERE a.amname = 'bloom' AND c.opcname = 'bloom_' || t.typ || '_ops') THEN
+            EXECUTE format('CREATE OPERATOR CLASS %I DEFAULT FOR TYPE %s USING bloom AS '
+                'OPERATOR 1 = (%2$s, %2$s), FUNCTION 1 %3$s(%2$s)', 'bloom_' || t.typ || '_ops', t.typ, t.fn);
+        END IF;
+        -- inside CREATE EXTENSION it is a member already
+        SELECT n.nspname, c.opcname, f.opfname,
+                NOT EXISTS (SELECT 1 FROM pg_depend d WHERE d.classid = 'pg_opclass'::regclass
+                    AND d.objid = c.oid AND d.deptype = 'e') AS add_class,
+                NOT EXISTS (SELECT 1 FROM pg_depend d WHERE d.classid = 'pg_opfamily'::regclass
+                    AND d.objid = f.oid AND d.deptype = 'e') AS add_family
+            INTO o
+            FROM pg_opclass c
+            JOIN pg_am a ON a.oid = c.opcmethod
+            JOIN pg_opfamily f ON f.oid = c.opcfamily
+            JOIN pg_namespace n ON n.oid = c.opcnamespace
+            WHERE a.amname = 'bloom' AND c.opcname = 'bloom_' || t.typ || '_ops';
+        IF o.add_family THEN
+            EXECUTE format('ALTER EXTENSION chess_index ADD OPERATOR FAMILY %I.%I USING bloom', o.nspname, o.opfname);
+        END IF;
+        IF o.add_class THEN
+            EXECUTE format('ALTER EXTENSION chess_index ADD OPERATOR CLASS %I.%I USING bloom', o.nspname, o.opcname);
+        END IF;
+    END LOOP;
+END;
+$$ LANGUAGE plpgsql;
+
+DO $$
+BEGIN
+    IF EXISTS (SELECT 1 FROM pg_am WHERE amname = 'bloom') THEN
+        PERFORM create_bloom_opclasses();
+    END IF;
+END;
+$$;
 /*}}}*/
@@ -13,8 +13,42 @@
 #include "utils/lsyscache.h"
 #include "catalog/namespace.h"
 #include "catalog/pg_type.h"
-
-#define EXTRA_DEBUG 1
+#include "common/hashfn.h"
+#include "port/pg_bitutils.h"
+#include "port/pg_bswap.h"
+#include "utils/sortsupport.h"
+#include "libpq/pqformat.h"
+#include "access/gin.h"
+#include "access/gist.h"
+#include "access/stratnum.h"
+#include "access/htup_details.h"
+#include "funcapi.h"
+#include "utils/tuplestore.h"
+#include "miscadmin.h"
+#include "utils/expandeddatum.h"
+#include "utils/typcache.h"
+#include "access/skey.h"
+#include "access/brin_tuple.h"
+#include "utils/selfuncs.h"
+#include "catalog/pg_statistic.h"
+#include "commands/vacuum.h"
+#include "executor/spi.h"
+#include "storage/fd.h"
+#include "utils/acl.h"
+#include "catalog/pg_authid.h"
+#include "utils/guc.h"
+#include "access/xact.h"
+#include "portability/instr_time.h"
+#include "port/atomics.h"
+#include "storage/ipc.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+#include "utils/dsa.h"
+#include "lib/dshash.h"
+#include "utils/hsearch.h"
+#include "commands/extension.h"
+
+// build with PG_CPPFLAGS=-DEXTRA_DEBUG for extra debug logging
 /********************************************************
  * 		defines
  ********************************************************/
@@ -25,8 +59,17 @@
 PG_FUNCTION_INFO_V1(char_to_int);
 
 PG_FUNCTION_INFO_V1(board_in);
+PG_FUNCTION_INFO_V1(boards_from_text);
 PG_FUNCTION_INFO_V1(board_out);
+PG_FUNCTION_INFO_V1(export_fen);
+PG_FUNCTION_INFO_V1(chess_index_stats);
+PG_FUNCTION_INFO_V1(chess_index_stats_reset);
+PG_FUNCTION_INFO_V1(position_id);
+PG_FUNCTION_INFO_V1(position_of);
+PG_FUNCTION_INFO_V1(board_recv);
+PG_FUNCTION_INFO_V1(board_send);
 PG_FUNCTION_INFO_V1(board_cmp);
+PG_FUNCTION_INFO_V1(board_sortsupport);
 PG_FUNCTION_INFO_V1(board_eq);
 PG_FUNCTION_INFO_V1(board_ne);
 PG_FUNCTION_INFO_V1(board_lt);
@@ -34,29 +77,130 @@ PG_FUNCTION_INFO_V1(board_gt);
 PG_FUNCTION_INFO_V1(board_le);
 PG_FUNCTION_INFO_V1(board_ge);
 PG_FUNCTION_INFO_V1(board_hash);
+PG_FUNCTION_INFO_V1(board_hash_extended);
+PG_FUNCTION_INFO_V1(zobrist);
+PG_FUNCTION_INFO_V1(board_upgrade);
+PG_FUNCTION_INFO_V1(board_version);
 
 // board functions
 PG_FUNCTION_INFO_V1(pcount);
 PG_FUNCTION_INFO_V1(side);
 PG_FUNCTION_INFO_V1(pieces);
+PG_FUNCTION_INFO_V1(castling);
+PG_FUNCTION_INFO_V1(piece_at);
 
 PG_FUNCTION_INFO_V1(pindex_in);
 PG_FUNCTION_INFO_V1(pindex_out);
+PG_FUNCTION_INFO_V1(pindex_recv);
 PG_FUNCTION_INFO_V1(pindex_to_int32);
 
+PG_FUNCTION_INFO_V1(material_in);
+PG_FUNCTION_INFO_V1(material_out);
+PG_FUNCTION_INFO_V1(material_recv);
+PG_FUNCTION_INFO_V1(material_contains);
+PG_FUNCTION_INFO_V1(material_contained);
+PG_FUNCTION_INFO_V1(imbalance);
+PG_FUNCTION_INFO_V1(material_imbalance_le);
+PG_FUNCTION_INFO_V1(material_imbalance_ge);
+PG_FUNCTION_INFO_V1(material);
+
 PG_FUNCTION_INFO_V1(side_in);
 PG_FUNCTION_INFO_V1(side_out);
 PG_FUNCTION_INFO_V1(not);
 
 PG_FUNCTION_INFO_V1(square_in);
 PG_FUNCTION_INFO_V1(square_out);
+PG_FUNCTION_INFO_V1(square_recv);
 PG_FUNCTION_INFO_V1(int_to_square);
 
 PG_FUNCTION_INFO_V1(piecesquare_in);
 PG_FUNCTION_INFO_V1(piecesquare_out);
+PG_FUNCTION_INFO_V1(piecesquare_recv);
 PG_FUNCTION_INFO_V1(piecesquare_piece);
 PG_FUNCTION_INFO_V1(piecesquare_square);
 
+PG_FUNCTION_INFO_V1(board_contains);
+PG_FUNCTION_INFO_V1(board_overlaps);
+PG_FUNCTION_INFO_V1(board_gin_extract_value);
+PG_FUNCTION_INFO_V1(board_gin_extract_query);
+PG_FUNCTION_INFO_V1(board_gin_consistent);
+PG_FUNCTION_INFO_V1(board_gin_triconsistent);
+
+PG_FUNCTION_INFO_V1(pawnkey_in);
+PG_FUNCTION_INFO_V1(pawnkey_out);
+PG_FUNCTION_INFO_V1(pawnkey_recv);
+PG_FUNCTION_INFO_V1(pawnkey_send);
+PG_FUNCTION_INFO_V1(pawnkey_cmp);
+PG_FUNCTION_INFO_V1(pawnkey_eq);
+PG_FUNCTION_INFO_V1(pawnkey_ne);
+PG_FUNCTION_INFO_V1(pawnkey_lt);
+PG_FUNCTION_INFO_V1(pawnkey_gt);
+PG_FUNCTION_INFO_V1(pawnkey_le);
+PG_FUNCTION_INFO_V1(pawnkey_ge);
+PG_FUNCTION_INFO_V1(pawnkey_hash);
+PG_FUNCTION_INFO_V1(pawnkey_hash_extended);
+PG_FUNCTION_INFO_V1(pawnkey_contains);
+PG_FUNCTION_INFO_V1(pawnkey_contained);
+PG_FUNCTION_INFO_V1(pawnkey_gin_extract_value);
+PG_FUNCTION_INFO_V1(pawnkey_gin_extract_query);
+PG_FUNCTION_INFO_V1(pawnkey_gin_consistent);
+PG_FUNCTION_INFO_V1(pawnkey_gin_triconsistent);
+PG_FUNCTION_INFO_V1(pawns);
+
+PG_FUNCTION_INFO_V1(boardsig_in);
+PG_FUNCTION_INFO_V1(boardsig_out);
+PG_FUNCTION_INFO_V1(board_contains_board);
+PG_FUNCTION_INFO_V1(board_contained_board);
+PG_FUNCTION_INFO_V1(board_gist_consistent);
+PG_FUNCTION_INFO_V1(board_gist_union);
+PG_FUNCTION_INFO_V1(board_gist_compress);
+PG_FUNCTION_INFO_V1(board_gist_penalty);
+PG_FUNCTION_INFO_V1(board_gist_picksplit);
+PG_FUNCTION_INFO_V1(board_gist_same);
+PG_FUNCTION_INFO_V1(board_distance);
+PG_FUNCTION_INFO_V1(board_gist_distance);
+
+PG_FUNCTION_INFO_V1(board_pcount_le);
+PG_FUNCTION_INFO_V1(board_pcount_ge);
+PG_FUNCTION_INFO_V1(board_material_eq);
+PG_FUNCTION_INFO_V1(board_brin_opcinfo);
+PG_FUNCTION_INFO_V1(board_brin_add_value);
+PG_FUNCTION_INFO_V1(board_brin_consistent);
+PG_FUNCTION_INFO_V1(board_brin_union);
+PG_FUNCTION_INFO_V1(board_typanalyze);
+PG_FUNCTION_INFO_V1(board_contsel);
+PG_FUNCTION_INFO_V1(board_containedsel);
+PG_FUNCTION_INFO_V1(board_overlapsel);
+PG_FUNCTION_INFO_V1(board_eqsel);
+PG_FUNCTION_INFO_V1(board_lesel);
+PG_FUNCTION_INFO_V1(board_gesel);
+PG_FUNCTION_INFO_V1(board_joinsel);
+
+PG_FUNCTION_INFO_V1(heatmap_transfn);
+PG_FUNCTION_INFO_V1(heatmap_invfn);
+PG_FUNCTION_INFO_V1(heatmap_combine);
+PG_FUNCTION_INFO_V1(heatmap_serialize);
+PG_FUNCTION_INFO_V1(heatmap_deserialize);
+PG_FUNCTION_INFO_V1(heatmap_final);
+
+PG_FUNCTION_INFO_V1(moves);
+PG_FUNCTION_INFO_V1(legal_move_count);
+PG_FUNCTION_INFO_V1(board_apply);
+PG_FUNCTION_INFO_V1(board_expand);
+PG_FUNCTION_INFO_V1(flip_colors);
+PG_FUNCTION_INFO_V1(mirror_files);
+PG_FUNCTION_INFO_V1(canonical);
+PG_FUNCTION_INFO_V1(replay);
+PG_FUNCTION_INFO_V1(pgn_positions);
+PG_FUNCTION_INFO_V1(perft);
+PG_FUNCTION_INFO_V1(perft_divide);
+
+PG_FUNCTION_INFO_V1(attacks);
+PG_FUNCTION_INFO_V1(attackers);
+PG_FUNCTION_INFO_V1(in_check);
+PG_FUNCTION_INFO_V1(pinned);
+PG_FUNCTION_INFO_V1(hanging);
+
 PG_FUNCTION_INFO_V1(piece_in);
 PG_FUNCTION_INFO_V1(piece_out);
 
@@ -80,7 +224,7 @@ PG_FUNCTION_INFO_V1(square_to_adiagonal);
 // defines
 ///*{{{*/
 #define CHECK_BIT(board, k) ((1ull << k) & board)
-#define GET_PIECE(pieces, k) k%2 ? pieces[k/2] & 0x0f : (pieces[k/2] & 0xf0) >> 4
+#define GET_PIECE(pieces, k) ((k)%2 ? pieces[(k)/2] & 0x0f : (pieces[(k)/2] & 0xf0) >> 4)
 #define SET_PIECE(pieces, k, v) pieces[k/2] = k%2 ? ( (pieces[k/2] & 0xF0) | (v & 0xF)) : ((pieces[k/2] & 0x0F) | (v & 0xF) << 4)
 #define SET_BIT16(i16, k) i16 |= ((int16)1 << (k));
 #define SET_BIT32(i32, k) i32 |= ((int32)1 << (k));
@@ -99,9 +243,24 @@ PG_FUNCTION_INFO_V1(square_to_adiagonal);
 #define FEN_MAX 100
 #define PIECES_MAX 32
 #define SQUARE_MAX 64
+#define CASTLE_MAX 4
+#define CFILE_MAX 8
+#define PINDEX_MAX 0x7fff
+
+// version byte leading the binary (send/recv) format of board
+#define BOARD_SEND_VERSION 1
+// version of the stored board; 0 is the layout that carried orig_fen
+#define BOARD_VERSION 1
+#define BOARD_LEGACY_PIECES_OFFSET 116
+
+// strategies of gin_board_ops and gin_pawnkey_ops, numbered like the core array opclass
+#define GIN_OVERLAP_STRATEGY 1
+#define GIN_CONTAINS_STRATEGY 2
+#define GIN_CONTAINED_STRATEGY 3
+#define GIN_EQUAL_STRATEGY 4
 
 #define SET_BOARD(board, k) board |= (1ull << (k--));
-#define TO_SQUARE_IDX(i)  (i/8)*8 + (8 - i%8) - 1;
+#define TO_SQUARE_IDX(i)  (((i)/8)*8 + (8 - (i)%8) - 1)
 #define MAKE_SQUARE(file, rank, str) {str[0]=file; str[1]=rank;}
 #define CHAR_CFILE(s) 'a' + TO_FILE(s)
 #define CHAR_RANK(s) '1' + TO_RANK(s)
@@ -115,6 +274,12 @@ PG_FUNCTION_INFO_V1(square_to_adiagonal);
 #define CH_DEBUG3(...) ereport(DEBUG3, (errcode(ERRCODE_INTERNAL_ERROR), errmsg(__VA_ARGS__)))
 #define CH_DEBUG2(...) ereport(DEBUG2, (errcode(ERRCODE_INTERNAL_ERROR), errmsg(__VA_ARGS__)))
 #define CH_DEBUG1(...) ereport(DEBUG1, (errcode(ERRCODE_INTERNAL_ERROR), errmsg(__VA_ARGS__))) // least detail
+// for the hot paths: compiled out unless built with EXTRA_DEBUG
+#ifdef EXTRA_DEBUG
+#define CH_TRACE(...) CH_DEBUG5(__VA_ARGS__)
+#else
+#define CH_TRACE(...) ((void) 0)
+#endif
 
 #define BAD_TYPE_IN(type, input) ereport( \
         ERROR, (errcode(ERRCODE_INVALID_TEXT_REPRESENTATION), \
@@ -122,7 +287,11 @@ PG_FUNCTION_INFO_V1(square_to_adiagonal);
 
 #define BAD_TYPE_OUT(type, input) ereport( \
         ERROR, (errcode(ERRCODE_DATA_CORRUPTED), \
-            errmsg("corrupt internal data for %s: \"%d\"", type, input)))/*}}}*/
+            errmsg("corrupt internal data for %s: \"%d\"", type, input))) \
+
+#define BAD_TYPE_RECV(type, input) ereport( \
+        ERROR, (errcode(ERRCODE_INVALID_BINARY_REPRESENTATION), \
+            errmsg("invalid external binary data for %s: \"%d\"", type, input)))/*}}}*/
 // types
 /*{{{*/
 typedef enum            {BLACK, WHITE} side_type;
@@ -140,13 +309,29 @@ const int               PIECE_INDEX_COUNTS[] = {1, 2, 2, 2, 8};
 #define PIECE_INDEX_SUM 15
 #define PIECE_INDEX_MAX 5
 
+/*
+ * material: the count of each cpiece_type in 5 bits, WHITE_PAWN in the
+ * low bits, so equal material is equal int8 and the top 4 bits are clear.
+ */
+#define MATERIAL_BITS 5
+#define MATERIAL_COUNT_MAX 31
+#define MATERIAL_MASK ((1ull << (MATERIAL_BITS * CPIECE_MAX)) - 1)
+#define MATERIAL_COUNT(m, p) ((int)(((m) >> ((p) * MATERIAL_BITS)) & MATERIAL_COUNT_MAX))
+#define MATERIAL_ADD(m, p, n) ((m) += (uint64)(n) << ((p) * MATERIAL_BITS))
+
+// pawn units for imbalance, by piece_type
+const int               PIECE_VALUES[] = {0, 1, 3, 3, 5, 9, 0};
+
 
 /*
- * base-size -> 14: 8 byte bitboard + 4 byte struct length (required by pg) + 2 for state
- * min size ->  16: 3 pieces of 4 bit nibbles = 2 bytes
- * max size ->  30: 32 pieces of 4 bit nibbles = 16 bytes
+ * base-size -> 16: 4 byte struct length (required by pg) + 4 for state + 8 byte bitboard
+ * min size ->  17: 2 pieces of 4 bit nibbles = 1 byte
+ * max size ->  32: 32 pieces of 4 bit nibbles = 16 bytes
  *
- * reality of alignment 16-32
+ * on disk the 4 byte length becomes a 1 byte short header: 14-29 bytes
+ *
+ * Version 0 boards had a 100 byte orig_fen between the bitboard and the
+ * pieces; they are upgraded when read (see _board_get).
  */
 typedef struct {
     int32                 vl_len;
@@ -157,16 +342,57 @@ typedef struct {
     unsigned int          wq : 1;
     unsigned int          bk : 1;
     unsigned int          bq : 1;
-    unsigned int          _unused: 14;
+    unsigned int          version : 2;
+    unsigned int          _unused: 12;
     int64                 board;
-#ifdef EXTRA_DEBUG
-	char			orig_fen[FEN_MAX];
-#endif
     unsigned char   pieces[FLEXIBLE_ARRAY_MEMBER];
 } Board;
 
+#define PG_GETARG_BOARD(n) _board_get(PG_GETARG_DATUM(n))
+#define BOARD_SIZE(pcount) (sizeof(Board) + (pcount)/2 + (pcount)%2)
+
+/*
+ * gist key: one occupancy mask per piece type (square numbering).
+ * Leaves also keep the state bits of the board in flags.
+ */
+typedef struct {
+    int32                 vl_len;
+    int32                 flags;
+    uint64                masks[CPIECE_MAX];
+} BoardSig;
+
+#define BOARDSIG_LEAF 0x10000
+
+/*
+ * pawnkey: the pawns of each side (square numbering), indexed by side_type.
+ * Fixed 16 bytes, passed by reference.
+ */
+typedef struct {
+    uint64                pawns[2];
+} PawnKey;
+
+#define PG_GETARG_PAWNKEY(n) ((PawnKey *) PG_GETARG_POINTER(n))
+#define PG_GETARG_BOARDSIG(n) ((BoardSig *) PG_DETOAST_DATUM(PG_GETARG_DATUM(n)))
+
 static char *_square_out(char c, char *str);
 static int _board_fen(const Board * b, char * str);
+static uint64 _board_datum_zobrist(Datum d);
+static uint64 _board_datum_bytes(Datum d);
+static uint64 _board_datum_material(Datum d);
+static void _board_datum_pawns(Datum d, PawnKey *key);
+
+/*
+ * zobrist keys: one per piece per square, castle right, enpassant file
+ * and for black to move. Filled from a fixed seed on load so the values
+ * (and therefore hash indexes) are stable across backends and restarts.
+ */
+#define ZOBRIST_SEED 0x43484553535a4f42ull // "CHESSZOB"
+static uint64           zobrist_pieces[CPIECE_MAX][SQUARE_MAX];
+static uint64           zobrist_castle[CASTLE_MAX];
+static uint64           zobrist_enpassant[CFILE_MAX];
+static uint64           zobrist_black;
+
+void _PG_init(void);
 
 #ifdef PG_MODULE_MAGIC
 PG_MODULE_MAGIC;
@@ -318,33 +544,267 @@ static piece_type _piece_type_in(char c)
     return result;
 }
 
-static char _piece_type_char(const piece_type p) 
+//http://prng.di.unimi.it/splitmix64.c
+static uint64 _splitmix64(uint64 *state)
 {
-    char        result;
-    switch (p) {
-        case NO_PIECE:  result='.'; break;
-        case PAWN:      result='P'; break;
-        case KNIGHT:    result='N'; break;
-        case BISHOP:    result='B'; break;
-        case ROOK:      result='R'; break;
-        case QUEEN:     result='Q'; break;
-        case KING:      result='K'; break;
+    uint64              z = (*state += 0x9e3779b97f4a7c15ull);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+static void _zobrist_init(void)
+{
+    uint64              state = ZOBRIST_SEED;
+    int                 i, j;
+
+    for (i=0; i<CPIECE_MAX; i++)
+        for (j=0; j<SQUARE_MAX; j++)
+            zobrist_pieces[i][j] = _splitmix64(&state);
+    for (i=0; i<CASTLE_MAX; i++)
+        zobrist_castle[i] = _splitmix64(&state);
+    for (i=0; i<CFILE_MAX; i++)
+        zobrist_enpassant[i] = _splitmix64(&state);
+    zobrist_black = _splitmix64(&state);
+}
+
+/*
+ * hot path statistics: calls, bytes and time of the board functions and the
+ * index support functions. Each backend counts into chess_stats; with the
+ * library in shared_preload_libraries the counts are also added to shared
+ * memory at the end of each transaction. Timing costs two clock reads per
+ * call so it is off unless chess_index.track_timing is set.
+ */
+typedef enum {STAT_BOARD_IN, STAT_BOARD_OUT, STAT_BOARD_HASH, STAT_BOARD_CMP,
+    STAT_GIN, STAT_GIST, STAT_BRIN, STAT_MAX} stat_type;
+static const char *STAT_NAMES[STAT_MAX] = {"board_in", "board_out", "board_hash", "board_cmp",
+    "gin_board_ops", "gist_board_ops", "brin_board_ops"};
+
+typedef struct {
+    uint64          calls;
+    uint64          bytes;
+    uint64          nanoseconds;
+} ChessStat;
+
+typedef struct {
+    pg_atomic_uint64    calls;
+    pg_atomic_uint64    bytes;
+    pg_atomic_uint64    nanoseconds;
+} ChessSharedStat;
+
+static bool             chess_index_track_stats = true;
+static bool             chess_index_track_timing = false;
+static ChessStat        chess_stats[STAT_MAX];
+// what has been added to shared memory so far
+static ChessStat        chess_stats_flushed[STAT_MAX];
+static ChessSharedStat  *chess_shared_stats = NULL;
+static shmem_request_hook_type prev_shmem_request_hook = NULL;
+static shmem_startup_hook_type prev_shmem_startup_hook = NULL;
+
+#if PG_VERSION_NUM >= 160000
+#define INSTR_TIME_NANOSEC(t) INSTR_TIME_GET_NANOSEC(t)
+#else
+#define INSTR_TIME_NANOSEC(t) ((uint64) (INSTR_TIME_GET_DOUBLE(t) * 1e9))
+#endif
+
+static inline void _stat_start(instr_time *start)
+{
+    if (chess_index_track_timing)
+        INSTR_TIME_SET_CURRENT(*start);
+    else
+        INSTR_TIME_SET_ZERO(*start);
+}
+
+static inline void _stat_end(stat_type s, instr_time *start, uint64 bytes)
+{
+    instr_time      now;
+
+    if (!chess_index_track_stats)
+        return;
+    chess_stats[s].calls++;
+    chess_stats[s].bytes += bytes;
+    if (chess_index_track_timing) {
+        INSTR_TIME_SET_CURRENT(now);
+        INSTR_TIME_SUBTRACT(now, *start);
+        chess_stats[s].nanoseconds += INSTR_TIME_NANOSEC(now);
+    }
+}
+
+/*
+ * Defines the sql callable fn as a counting wrapper around _fn, for support
+ * functions with too many returns to count inline. Follow it with the
+ * definition of _fn.
+ */
+#define CH_STAT_FUNCTION(stat, fn) \
+    static Datum _##fn(PG_FUNCTION_ARGS); \
+    Datum \
+    fn(PG_FUNCTION_ARGS) \
+    { \
+        instr_time      start; \
+        Datum           result; \
+        _stat_start(&start); \
+        result = _##fn(fcinfo); \
+        _stat_end(stat, &start, 0); \
+        return result; \
+    }
+
+static void _stats_flush(void)
+{
+    ChessStat       *l, *f;
+    int             i;
+
+    if (chess_shared_stats == NULL)
+        return;
+    for (i=0; i<STAT_MAX; i++) {
+        l = &chess_stats[i];
+        f = &chess_stats_flushed[i];
+        if (l->calls == f->calls)
+            continue;
+        pg_atomic_fetch_add_u64(&chess_shared_stats[i].calls, l->calls - f->calls);
+        pg_atomic_fetch_add_u64(&chess_shared_stats[i].bytes, l->bytes - f->bytes);
+        pg_atomic_fetch_add_u64(&chess_shared_stats[i].nanoseconds, l->nanoseconds - f->nanoseconds);
+        *f = *l;
+    }
+}
+
+static void _stats_xact_callback(XactEvent event, void *arg)
+{
+    switch (event) {
+        case XACT_EVENT_COMMIT:
+        case XACT_EVENT_ABORT:
+        case XACT_EVENT_PARALLEL_COMMIT:
+        case XACT_EVENT_PARALLEL_ABORT:
+            _stats_flush();
+            break;
         default:
-            CH_ERROR("bad piece_type: %i", p); break;
+            break;
     }
-    return result;
 }
 
-//http://www.cse.yorku.ca/~oz/hash.html
-static unsigned int _sdbm_hash(str)
-unsigned char *str;
+static void _intern_shmem_request(void);
+static void _intern_shmem_startup(void);
+
+static void _shmem_request(void)
+{
+    if (prev_shmem_request_hook)
+        prev_shmem_request_hook();
+    RequestAddinShmemSpace(sizeof(ChessSharedStat) * STAT_MAX);
+    _intern_shmem_request();
+}
+
+static void _shmem_startup(void)
+{
+    bool            found;
+    int             i;
+
+    if (prev_shmem_startup_hook)
+        prev_shmem_startup_hook();
+    LWLockAcquire(AddinShmemInitLock, LW_EXCLUSIVE);
+    chess_shared_stats = ShmemInitStruct("chess_index stats", sizeof(ChessSharedStat) * STAT_MAX, &found);
+    if (!found) {
+        for (i=0; i<STAT_MAX; i++) {
+            pg_atomic_init_u64(&chess_shared_stats[i].calls, 0);
+            pg_atomic_init_u64(&chess_shared_stats[i].bytes, 0);
+            pg_atomic_init_u64(&chess_shared_stats[i].nanoseconds, 0);
+        }
+    }
+    _intern_shmem_startup();
+    LWLockRelease(AddinShmemInitLock);
+}
+
+static void _stats_init(void)
+{
+    DefineCustomBoolVariable("chess_index.track_stats",
+            "Counts calls and bytes of the board functions for chess_index_stats().",
+            NULL, &chess_index_track_stats, true, PGC_USERSET, 0, NULL, NULL, NULL);
+    DefineCustomBoolVariable("chess_index.track_timing",
+            "Times the board functions counted by chess_index.track_stats.",
+            NULL, &chess_index_track_timing, false, PGC_SUSET, 0, NULL, NULL, NULL);
+    RegisterXactCallback(_stats_xact_callback, NULL);
+}
+
+static void _stats_shared_check(void)
 {
-	unsigned long long hash = 0;
-	int c;
+    if (chess_shared_stats == NULL)
+        CH_ERROR("shared stats need chess_index in shared_preload_libraries");
+}
+
+/* one row per counted function; shared adds every backend's finished transactions */
+Datum
+chess_index_stats(PG_FUNCTION_ARGS)
+{
+    bool            shared = PG_GETARG_BOOL(0);
+    ReturnSetInfo   *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+    Datum           values[4];
+    bool            nulls[4] = {false, false, false, false};
+    int             i;
+
+    if (shared) {
+        _stats_shared_check();
+        _stats_flush();
+    }
+    InitMaterializedSRF(fcinfo, 0);
+    for (i=0; i<STAT_MAX; i++) {
+        values[0] = CStringGetTextDatum(STAT_NAMES[i]);
+        if (shared) {
+            values[1] = Int64GetDatum(pg_atomic_read_u64(&chess_shared_stats[i].calls));
+            values[2] = Int64GetDatum(pg_atomic_read_u64(&chess_shared_stats[i].bytes));
+            values[3] = Int64GetDatum(pg_atomic_read_u64(&chess_shared_stats[i].nanoseconds));
+        } else {
+            values[1] = Int64GetDatum(chess_stats[i].calls);
+            values[2] = Int64GetDatum(chess_stats[i].bytes);
+            values[3] = Int64GetDatum(chess_stats[i].nanoseconds);
+        }
+        tuplestore_putvalues(rsinfo->setResult, rsinfo->setDesc, values, nulls);
+    }
+    return (Datum) 0;
+}
+
+Datum
+chess_index_stats_reset(PG_FUNCTION_ARGS)
+{
+    int             i;
+
+    if (PG_GETARG_BOOL(0)) {
+        _stats_shared_check();
+        for (i=0; i<STAT_MAX; i++) {
+            pg_atomic_write_u64(&chess_shared_stats[i].calls, 0);
+            pg_atomic_write_u64(&chess_shared_stats[i].bytes, 0);
+            pg_atomic_write_u64(&chess_shared_stats[i].nanoseconds, 0);
+        }
+        // this backend's unflushed counts go with the reset too
+        memcpy(chess_stats_flushed, chess_stats, sizeof(chess_stats));
+    } else {
+        // keep what is not yet in shared memory
+        _stats_flush();
+        memset(chess_stats, 0, sizeof(chess_stats));
+        memset(chess_stats_flushed, 0, sizeof(chess_stats_flushed));
+    }
+    PG_RETURN_VOID();
+}
 
-	while ((c = *str++))
-		hash = c + (hash << 6) + (hash << 16) - hash;
-	return hash;
+static void _attacks_init(void);
+static void _fen_init(void);
+static void _intern_init(void);
+
+void
+_PG_init(void)
+{
+    _zobrist_init();
+    _attacks_init();
+    _fen_init();
+    _stats_init();
+    _intern_init();
+    MarkGUCPrefixReserved("chess_index");
+
+    // shared stats and the intern table
+    if (process_shared_preload_libraries_in_progress) {
+        prev_shmem_request_hook = shmem_request_hook;
+        shmem_request_hook = _shmem_request;
+        prev_shmem_startup_hook = shmem_startup_hook;
+        shmem_startup_hook = _shmem_startup;
+    }
 }
 
 #ifdef EXTRA_DEBUG
@@ -354,7 +814,6 @@ static void debug_bitboard(int64 a) {
     int             cnt=SQUARE_MAX-1;
     int64           b = a;
 
-    str += (SQUARE_MAX - 1);
 	while (cnt >=0) {
           str[cnt] = (b & 1) + '0';
           b >>= 1;
@@ -371,7 +830,6 @@ static void debug_bits(int64 a, unsigned char bits) {
     int             cnt=bits-1;
     int64           b = a;
 
-    str += (bits- 1);
 	while (cnt >=0) {
           str[cnt] = (b & 1) + '0';
           b >>= 1;
@@ -528,12 +986,7 @@ static char _square_in(char file, char rank)
 
     c = (file - 'a') + ( 8 * (rank - '1'));
 
-    CH_DEBUG5("_square_in: file:%c rank:%c char:%i", file, rank, c);
-#ifdef EXTRA_DEBUG
-    CH_DEBUG5("_square_in char of file rank: %c%c:", CHAR_CFILE(c), CHAR_RANK(c));
-    CH_DEBUG5("c file:%i c rank:%i", TO_FILE(c), TO_RANK(c));
-    CH_DEBUG5("file - 'a':%i rank-'1':%i", file -'a', rank-'1');
-#endif
+    CH_TRACE("_square_in: file:%c rank:%c char:%i", file, rank, c);
 
     if (c < 0 || c > 63) {
         MAKE_SQUARE(file, rank, square);
@@ -601,6 +1054,17 @@ square_out(PG_FUNCTION_ARGS)
     PG_RETURN_CSTRING(result);
 }
 
+Datum
+square_recv(PG_FUNCTION_ARGS)
+{
+    StringInfo      buf = (StringInfo) PG_GETARG_POINTER(0);
+    int             square = pq_getmsgbyte(buf);
+
+    if (square < 0 || square >= SQUARE_MAX)
+        BAD_TYPE_RECV("square", square);
+    PG_RETURN_CHAR(square);
+}
+
 Datum
 int_to_square(PG_FUNCTION_ARGS)
 {
@@ -892,6 +1356,17 @@ pindex_out(PG_FUNCTION_ARGS)
     PG_RETURN_CSTRING(result);
 }
 
+Datum
+pindex_recv(PG_FUNCTION_ARGS)
+{
+    StringInfo      buf = (StringInfo) PG_GETARG_POINTER(0);
+    unsigned int    pindex = pq_getmsgint(buf, sizeof(int16));
+
+    if (pindex > PINDEX_MAX)
+        BAD_TYPE_RECV("pindex", pindex);
+    PG_RETURN_INT16(pindex);
+}
+
 Datum
 pindex_to_int32(PG_FUNCTION_ARGS)
 {
@@ -899,367 +1374,656 @@ pindex_to_int32(PG_FUNCTION_ARGS)
     PG_RETURN_INT32((int32)pindex);
 }
 
+/* the pindex of one side: each group gets its high bits set, up to its count */
+static unsigned short _material_pindex(uint64 m, side_type go)
+{
+    unsigned short  result = 0;
+    int             i, n, shift = PIECE_INDEX_SUM;
+    const cpiece_type    *pieces = go==WHITE ? WHITE_PIECES : BLACK_PIECES;
+
+    for (i=0; i<PIECE_INDEX_MAX; i++) {
+        n = Min(MATERIAL_COUNT(m, pieces[i]), PIECE_INDEX_COUNTS[i]);
+        result |= ((1 << n) - 1) << (shift - n);
+        shift -= PIECE_INDEX_COUNTS[i];
+    }
+    return result;
+}
+
 /*}}}*/
 /********************************************************
- **     board
+ * 	    material: piece counts of both sides
  ********************************************************/
 /*{{{*/
-/* 
- * This is a really nice compact way to store fen without Huffman compresion:
- * https://codegolf.stackexchange.com/questions/19397/smallest-chess-board-compression
- * second answer : 192 bits
- */
- 
-//  static internal/*{{{*/
 
-static int _board_compare(const Board *a, const Board *b) 
+// output order, white then black
+const cpiece_type       MATERIAL_ORDER[] = {WHITE_KING, WHITE_QUEEN, WHITE_ROOK, WHITE_BISHOP, WHITE_KNIGHT, WHITE_PAWN,
+                                            BLACK_KING, BLACK_QUEEN, BLACK_ROOK, BLACK_BISHOP, BLACK_KNIGHT, BLACK_PAWN};
+
+/* a piece letter per piece in any order: 'KRPkr' */
+Datum
+material_in(PG_FUNCTION_ARGS)
 {
-    if (a->pcount > b->pcount)
-        return 1;
-    else if (a->pcount < b->pcount)
-        return -1;
-    else
-        return (memcmp(a, b, sizeof(a) + a->pcount));
+    char            *str = PG_GETARG_CSTRING(0);
+    uint64          result = 0;
+    cpiece_type     p;
+    char            *c;
+
+    for (c=str; *c; c++) {
+        if (!strchr("KQRBNPkqrbnp", *c))
+            BAD_TYPE_IN("material", str);
+        p = _cpiece_type_in(*c);
+        if (MATERIAL_COUNT(result, p) == MATERIAL_COUNT_MAX)
+            BAD_TYPE_IN("material", str);
+        MATERIAL_ADD(result, p, 1);
+    }
+    PG_RETURN_INT64(result);
 }
 
-static char *_board_pieces(const Board * b, side_type go)
+Datum
+material_out(PG_FUNCTION_ARGS)
 {
-
-    char                *result=palloc(PIECE_INDEX_SUM+1); // 15 pieces without K
-    unsigned int        i;
-    unsigned char       j=0, k, l, n;
-    cpiece_type         subject, target;
-    const cpiece_type    *pieces = go==WHITE ? WHITE_PIECES : BLACK_PIECES;
-
-    if (b->pcount <=0)
-        CH_ERROR("board has no pieces");
-
-    for (i=0; i<PIECE_INDEX_MAX; i++) {
-        n = 0;
-        target = pieces[i];
-        //CH_NOTICE("target: %c", _piece_out(target));
-
-        for (k=0; k<b->pcount; k++) {
-            subject = GET_PIECE(b->pieces, k);
-            if (subject == target) {
-                n++;
-                if (n >= PIECE_INDEX_COUNTS[i])
-                    break;
-            }
-        }
-        //CH_NOTICE("n: %i", n);
-        for (l=0; l<PIECE_INDEX_COUNTS[i]; l++) {
-            if (l<n) {
-                result[j++] = _piece_type_char(_piece_type(target));
-            } else {
-                result[j++] = _piece_type_char(NO_PIECE);
-            }
-        }
+    uint64          m = PG_GETARG_INT64(0);
+    char            *result = palloc(CPIECE_MAX * MATERIAL_COUNT_MAX + 1);
+    int             i, n, j=0;
+    char            c;
+
+    for (i=0; i<CPIECE_MAX; i++) {
+        c = _cpiece_type_char(MATERIAL_ORDER[i]);
+        for (n=MATERIAL_COUNT(m, MATERIAL_ORDER[i]); n>0; n--)
+            result[j++] = c;
     }
-    result[PIECE_INDEX_SUM] = '\0';
-    return result;
+    result[j] = '\0';
+    PG_RETURN_CSTRING(result);
 }
 
-static int _board_fen(const Board * b, char * str)
+Datum
+material_recv(PG_FUNCTION_ARGS)
 {
-    int             i;
-    unsigned char   j=0, k=0, empties=0, s, piece;
-
-#ifdef EXTRA_DEBUG
-    debug_bitboard(b->board);
-    CH_DEBUG5("orig fen: %s", b->orig_fen);
-    CH_DEBUG5("piece count: %i", b->pcount);
-#endif
-    for (i=SQUARE_MAX-1; i>=0; i--) {
-        if (j >= FEN_MAX) {
-#ifdef EXTRA_DEBUG
-            CH_ERROR("internal error: fen is too long; original fen:'%s'", b->orig_fen);
-#else 
-            CH_ERROR("internal error: fen is too long");
-#endif
-        }
-        if (k > b->pcount) {
-#ifdef EXTRA_DEBUG
-            CH_ERROR("internal error: too many pieces; original fen:'%s'", b->orig_fen);
-#else 
-            CH_ERROR("internal error: too many pieces");
-#endif
-        }
-        // need for square type
-        s = TO_SQUARE_IDX(i);
-
-        // if its an empty square
-        if (!CHECK_BIT(b->board, i)) {
-            empties += 1;
-            // else there is apiece
-        } else {
-            // if we have some empties then empty them
-            if (empties) 
-                str[j++] = empties + '0';
-
-            empties = 0;
-            piece = GET_PIECE(b->pieces, k);
-            k++;
-
-            switch(piece) {
-                case BLACK_PAWN:    str[j++] = 'p'; break;
-                case BLACK_KNIGHT:  str[j++] = 'n'; break;
-                case BLACK_BISHOP:  str[j++] = 'b'; break;
-                case BLACK_ROOK:    str[j++] = 'r'; break;
-                case BLACK_QUEEN:   str[j++] = 'q'; break;
-                case BLACK_KING:    str[j++] = 'k'; break;
-                case WHITE_PAWN:    str[j++] = 'P'; break;
-                case WHITE_KNIGHT:  str[j++] = 'N'; break;
-                case WHITE_BISHOP:  str[j++] = 'B'; break;
-                case WHITE_ROOK:    str[j++] = 'R'; break;
-                case WHITE_QUEEN:   str[j++] = 'Q'; break;
-                case WHITE_KING:    str[j++] = 'K'; break;
-                default:
-                                    // should not get here :)
-                                    CH_ERROR("internal error: unknown piece type at piece %i in board: %i", k, piece);
-                                    break;
-            }
-            CH_DEBUG5("_fen_out: i:%i :square: %c%c piece:%c",i, CHAR_CFILE(s), CHAR_RANK(s), str[j-1]);
-        }
-        // if were at the end or a row add '/' and perhaps and empty number
-        if (i%8==0) { 
-            if (empties) 
-                str[j++] = empties + '0';
-            if (i) 
-                str[j++] = '/';
-            empties = 0;
-        }
-    }
-    str[j++] = ' ';
-    str[j++] = b->whitesgo ? 'w' : 'b';
+    StringInfo      buf = (StringInfo) PG_GETARG_POINTER(0);
+    uint64          m = pq_getmsgint64(buf);
 
-    str[j++] = ' ';
-    if (b->wk + b->wq + b->bk + b->bq > 0) {
-        if (b->wk) str[j++] = 'K';
-        if (b->wq) str[j++] = 'Q';
-        if (b->bk) str[j++] = 'k';
-        if (b->bq) str[j++] = 'q';
-    } else
-        str[j++] = '-';
+    if (m & ~MATERIAL_MASK)
+        BAD_TYPE_RECV("material", (int)(m >> 32));
+    PG_RETURN_INT64(m);
+}
 
-    str[j++] = ' ';
-    CH_DEBUG5("enp: %i", b->enpassant);
-    if (b->enpassant > -1) {
-        str[j++] = CHAR_CFILE(b->enpassant);
-        str[j++] = CHAR_RANK(b->enpassant);
-    } else
-        str[j++] = '-';
+/* true when a has at least the pieces of b */
+static bool _material_contains(uint64 a, uint64 b)
+{
+    int             p;
 
-    str[j++] = '\0';
-    return j;
+    for (p=0; p<CPIECE_MAX; p++)
+        if (MATERIAL_COUNT(a, p) < MATERIAL_COUNT(b, p))
+            return false;
+    return true;
 }
-/*}}}*/
-//-------------------------------------------
-//              operators/*{{{*/
 
 Datum
-board_cmp(PG_FUNCTION_ARGS)
+material_contains(PG_FUNCTION_ARGS)
 {
-    const Board     *a = (Board *) PG_GETARG_POINTER(0);
-    const Board     *b = (Board *) PG_GETARG_POINTER(1);
-    PG_RETURN_INT32(_board_compare(a, b));
+    PG_RETURN_BOOL(_material_contains(PG_GETARG_INT64(0), PG_GETARG_INT64(1)));
 }
 
 Datum
-board_eq(PG_FUNCTION_ARGS)
+material_contained(PG_FUNCTION_ARGS)
 {
-    const Board     *a = (Board *) PG_GETARG_POINTER(0);
-    const Board     *b = (Board *) PG_GETARG_POINTER(1);
-    PG_RETURN_BOOL(_board_compare(a, b) == 0);
+    PG_RETURN_BOOL(_material_contains(PG_GETARG_INT64(1), PG_GETARG_INT64(0)));
 }
 
-Datum
-board_ne(PG_FUNCTION_ARGS)
+/* white minus black in pawn units */
+static int32 _material_imbalance(uint64 m)
 {
-    const Board     *a = (Board *) PG_GETARG_POINTER(0);
-    const Board     *b = (Board *) PG_GETARG_POINTER(1);
-    PG_RETURN_BOOL(_board_compare(a, b) != 0);
+    int32           result = 0;
+    piece_type      p;
+
+    for (p=PAWN; p<KING; p++)
+        result += PIECE_VALUES[p] * (MATERIAL_COUNT(m, p - PAWN + WHITE_PAWN) - MATERIAL_COUNT(m, p - PAWN + BLACK_PAWN));
+    return result;
 }
 
 Datum
-board_lt(PG_FUNCTION_ARGS)
+imbalance(PG_FUNCTION_ARGS)
 {
-    const Board     *a = (Board *) PG_GETARG_POINTER(0);
-    const Board     *b = (Board *) PG_GETARG_POINTER(1);
-    PG_RETURN_BOOL(_board_compare(a, b) < 0);
+    PG_RETURN_INT32(_material_imbalance(PG_GETARG_INT64(0)));
 }
 
 Datum
-board_gt(PG_FUNCTION_ARGS)
+material_imbalance_le(PG_FUNCTION_ARGS)
 {
-    const Board     *a = (Board *) PG_GETARG_POINTER(0);
-    const Board     *b = (Board *) PG_GETARG_POINTER(1);
-    PG_RETURN_BOOL(_board_compare(a, b) > 0);
+    PG_RETURN_BOOL(_material_imbalance(PG_GETARG_INT64(0)) <= PG_GETARG_INT32(1));
 }
 
 Datum
-board_le(PG_FUNCTION_ARGS)
+material_imbalance_ge(PG_FUNCTION_ARGS)
 {
-    const Board     *a = (Board *) PG_GETARG_POINTER(0);
-    const Board     *b = (Board *) PG_GETARG_POINTER(1);
-    PG_RETURN_BOOL(_board_compare(a, b) <= 0);
+    PG_RETURN_BOOL(_material_imbalance(PG_GETARG_INT64(0)) >= PG_GETARG_INT32(1));
 }
 
-Datum
-board_ge(PG_FUNCTION_ARGS)
+/*}}}*/
+/********************************************************
+ **     board
+ ********************************************************/
+/*{{{*/
+/*
+ * This is a really nice compact way to store fen without Huffman compresion:
+ * https://codegolf.stackexchange.com/questions/19397/smallest-chess-board-compression
+ * second answer : 192 bits
+ */
+ 
+//  static internal/*{{{*/
+
+static Board *_board_alloc(unsigned char pcount)
 {
-    const Board     *a = (Board *) PG_GETARG_POINTER(0);
-    const Board     *b = (Board *) PG_GETARG_POINTER(1);
-    PG_RETURN_BOOL(_board_compare(a, b) >= 0);
+    size_t          size = BOARD_SIZE(pcount);
+    Board           *result = (Board *) palloc0(size);
+
+    SET_VARSIZE(result, size);
+    result->pcount = pcount;
+    result->version = BOARD_VERSION;
+    return result;
 }
 
-Datum
-board_hash(PG_FUNCTION_ARGS)
+/*
+ * Version 0 boards are the current layout with orig_fen[FEN_MAX] before
+ * the pieces, so only the pieces need moving.
+ */
+static Board *_board_upgrade(const Board *b)
 {
+    Board           *result;
 
-	const Board     *b = (Board *) PG_GETARG_POINTER(0);
-	char            str[FEN_MAX];
+    if (b->version != 0 || VARSIZE(b) < (Size) (BOARD_LEGACY_PIECES_OFFSET + b->pcount/2 + b->pcount%2))
+        BAD_TYPE_OUT("board version", b->version);
 
-	_board_fen(b, str);
-	PG_RETURN_INT64(_sdbm_hash(str));
+    result = _board_alloc(b->pcount);
+    memcpy(result, b, offsetof(Board, pieces));
+    SET_VARSIZE(result, sizeof(Board) + b->pcount/2 + b->pcount%2);
+    result->version = BOARD_VERSION;
+    memcpy(result->pieces, (char *) b + BOARD_LEGACY_PIECES_OFFSET, b->pcount/2 + b->pcount%2);
+    return result;
 }
 
-/*}}}*/
-//-------------------------------------------
-//              constructors/*{{{*/
+/* detoast (short headers are allowed on disk) and upgrade if needed */
+static Board *_board_get(Datum d)
+{
+    Board           *b = (Board *) PG_DETOAST_DATUM(d);
 
-Datum
-board_in(PG_FUNCTION_ARGS)
+    if (likely(b->version == BOARD_VERSION))
+        return b;
+    return _board_upgrade(b);
+}
+
+/* piece on a square (square type numbering) or -1 for an empty square */
+static int _board_piece_at(const Board *b, int square)
 {
-    char 			*str = PG_GETARG_CSTRING(0);
-    Board           *result;
-    unsigned char   c, p='\0', pieces[PIECES_MAX];
-    int64           bitboard=0;
-    int             i=0, j=SQUARE_MAX-1, k=0, s;
-    bool            done=false, wk=false, wq=false, bk=false, bq=false;
-    char            enpassant=-1, whitesgo=-1;
-    size_t          s1, s2;
+    int             i = TO_SQUARE_IDX(square); // works both ways
 
-    if (strlen(str) > FEN_MAX)
-        CH_ERROR("fen string too long");
-    memset(pieces, 0, PIECES_MAX);
+    if (!CHECK_BIT(b->board, i))
+        return -1;
+    // pieces are ordered from the high bit down
+    return GET_PIECE(b->pieces, pg_popcount64((uint64) b->board & ~((2ull << i) - 1)));
+}
 
-    // fast forward to move side
-    while (str[i] != '\0') {
-        c = str[i++];
-        if (c == ' ') break;
+/* fills ps with a piecesquare for each piece and returns the count */
+static int _board_piecesquares(const Board *b, int16 *ps)
+{
+    uint64          bb = b->board;
+    int             i, k = 0;
+
+    while (bb) {
+        i = pg_leftmost_one_pos64(bb);
+        bb &= ~(1ull << i);
+        SET_PS(ps[k], GET_PIECE(b->pieces, k), TO_SQUARE_IDX(i));
+        k++;
     }
-    switch (str[i++]) {
-        case 'w': whitesgo=1; break;
-        case 'b': whitesgo=0; break;
-        default: CH_ERROR("bad move side in fen"); break;
+    return k;
+}
+
+/* one occupancy mask per piece type in square numbering */
+static void _board_masks(const Board *b, uint64 *masks)
+{
+    uint64          bb = b->board;
+    int             i, k = 0;
+
+    memset(masks, 0, sizeof(uint64) * CPIECE_MAX);
+    while (bb) {
+        i = pg_leftmost_one_pos64(bb);
+        bb &= ~(1ull << i);
+        masks[GET_PIECE(b->pieces, k)] |= 1ull << TO_SQUARE_IDX(i);
+        k++;
     }
-    i++;
-    while (str[i] != '\0' && str[i] != ' ') {
-        switch (str[i++]) {
-            case 'K': wk=true; break;
-            case 'Q': wq=true; break;
-            case 'k': bk=true; break;
-            case 'q': bq=true; break;
-            case '-': break;
-            default: CH_ERROR("bad castle availability in fen"); break;
-        }
+}
+
+/* every piece of b is on the same square in a */
+static bool _board_contains_board(const Board *a, const Board *b)
+{
+    uint64          bb = b->board;
+    int             i, k = 0;
+
+    if ((b->board & ~a->board) != 0)
+        return false;
+    while (bb) {
+        i = pg_leftmost_one_pos64(bb);
+        bb &= ~(1ull << i);
+        if (_board_piece_at(a, TO_SQUARE_IDX(i)) != GET_PIECE(b->pieces, k))
+            return false;
+        k++;
     }
-    c = str[++i];
-    if (c >= 'a' && c <= 'h') {
-        p = str[++i];
-        if (p != '3' && p != '6')
-            CH_ERROR("bad enpassant rank in fen '%c'", p);
-        enpassant = _square_in(c, p);
+    return true;
+}
 
-        CH_DEBUG5("_fen_in: enpessant: %c%c:", CHAR_CFILE(enpassant), CHAR_RANK(enpassant));
+static int _board_state(const Board *b)
+{
+    return b->whitesgo << 11 | b->wk << 10 | b->wq << 9 | b->bk << 8 | b->bq << 7
+        | (b->enpassant + 1);
+}
 
-        // enpassant is set on the capture not on the pawn
-        // so we have have to go up a rank to find the pawn
-        enpassant += (p=='3' ? 8 : -8);
+/*
+ * Total order: bitboard as unsigned, then the piece nibbles (same length
+ * once the bitboards are equal), then the state bits. The bitboard comes
+ * first so that it can serve as the abbreviated key for sorting.
+ */
+static int _board_compare(const Board *a, const Board *b) 
+{
+    uint64          ua = a->board, ub = b->board;
+    int             cmp;
 
-    } else if (c=='-') {
-    } else {
-        CH_DEBUG5("fen:'%s':", str);
-        CH_ERROR("bad enpassant in fen: '%c%i':", c, p);
+    if (ua != ub)
+        return ua > ub ? 1 : -1;
+
+    cmp = memcmp(a->pieces, b->pieces, a->pcount/2 + a->pcount%2);
+    if (cmp)
+        return cmp > 0 ? 1 : -1;
+
+    cmp = _board_state(a) - _board_state(b);
+    return cmp > 0 ? 1 : (cmp < 0 ? -1 : 0);
+}
+
+static int _board_fastcmp(Datum x, Datum y, SortSupport ssup)
+{
+    instr_time      start;
+    Board           *a, *b;
+    int             result;
+
+    _stat_start(&start);
+    a = _board_get(x);
+    b = _board_get(y);
+    result = _board_compare(a, b);
+    _stat_end(STAT_BOARD_CMP, &start, VARSIZE(a) + VARSIZE(b));
+    if ((Pointer) a != DatumGetPointer(x))
+        pfree(a);
+    if ((Pointer) b != DatumGetPointer(y))
+        pfree(b);
+    return result;
+}
+
+static Datum _board_abbrev_convert(Datum original, SortSupport ssup)
+{
+    Board           *b = _board_get(original);
+    uint64          board = b->board;
+
+    if ((Pointer) b != DatumGetPointer(original))
+        pfree(b);
+#if SIZEOF_DATUM == 8
+    return UInt64GetDatum(board);
+#else
+    return UInt32GetDatum((uint32) (board >> 32));
+#endif
+}
+
+/* compare the first two arguments without leaking detoasted copies */
+static int _board_compare_args(FunctionCallInfo fcinfo)
+{
+    instr_time      start;
+    Board           *a, *b;
+    int             result;
+
+    _stat_start(&start);
+    a = PG_GETARG_BOARD(0);
+    b = PG_GETARG_BOARD(1);
+    result = _board_compare(a, b);
+    _stat_end(STAT_BOARD_CMP, &start, VARSIZE(a) + VARSIZE(b));
+    PG_FREE_IF_COPY(a, 0);
+    PG_FREE_IF_COPY(b, 1);
+    return result;
+}
+
+/* converting is a single load so there is nothing to win by aborting */
+static bool _board_abbrev_abort(int memtupcount, SortSupport ssup)
+{
+    return false;
+}
+
+/*
+ * Pieces are stored in the order of the set bits of the bitboard from the
+ * high bit down, so walk the bitboard with a bit scan instead of testing
+ * all 64 squares.
+ */
+static uint64 _board_zobrist(const Board *b)
+{
+    uint64              key = 0, bb = b->board;
+    int                 i, k = 0;
+
+    while (bb) {
+        i = pg_leftmost_one_pos64(bb);
+        bb &= ~(1ull << i);
+        key ^= zobrist_pieces[GET_PIECE(b->pieces, k)][TO_SQUARE_IDX(i)];
+        k++;
     }
+    if (!b->whitesgo)   key ^= zobrist_black;
+    if (b->wk)          key ^= zobrist_castle[0];
+    if (b->wq)          key ^= zobrist_castle[1];
+    if (b->bk)          key ^= zobrist_castle[2];
+    if (b->bq)          key ^= zobrist_castle[3];
+    if (b->enpassant > -1)
+        key ^= zobrist_enpassant[TO_FILE(b->enpassant)];
+    return key;
+}
 
-    i = 0;
-    while (str[i] != '\0') {
+/* one pass over the piece nibbles */
+static uint64 _board_material(const Board *b)
+{
+    int                 counts[CPIECE_MAX] = {0};
+    int                 k, p;
+    uint64              result = 0;
+
+    for (k=0; k<b->pcount; k++)
+        counts[GET_PIECE(b->pieces, k)]++;
+    for (p=0; p<CPIECE_MAX; p++) {
+        if (counts[p] > MATERIAL_COUNT_MAX)
+            CH_ERROR("too many pieces of one kind for material: %d", counts[p]);
+        MATERIAL_ADD(result, p, counts[p]);
+    }
+    return result;
+}
 
-        // i indexes differently than square type (for enpassant)
-        s = TO_SQUARE_IDX(j);
+/* one pass over the bitboard, keeping the squares whose nibble is a pawn */
+static void _board_pawns(const Board *b, PawnKey *key)
+{
+    uint64              bb = b->board;
+    int                 i, k = 0, p;
+
+    key->pawns[WHITE] = key->pawns[BLACK] = 0;
+    while (bb) {
+        i = pg_leftmost_one_pos64(bb);
+        bb &= ~(1ull << i);
+        p = GET_PIECE(b->pieces, k);
+        k++;
+        if (p == WHITE_PAWN)
+            key->pawns[WHITE] |= 1ull << TO_SQUARE_IDX(i);
+        else if (p == BLACK_PAWN)
+            key->pawns[BLACK] |= 1ull << TO_SQUARE_IDX(i);
+    }
+}
 
-        switch (c=str[i]) {
-                case 'p': case 'n': case 'b': case 'r': case 'q': case 'k':
-                case 'P': case 'N': case 'B': case 'R': case 'Q': case 'K':
+/*
+ * fen_ranks[occupancy] is a fen rank for one byte of the bitboard (a-file in
+ * the high bit) with '*' standing for each piece, e.g. 0x4e is "1*2***1".
+ */
+static char fen_ranks[256][9];
+static const char FEN_CHARS[CPIECE_MAX] = "PNBRQKpnbrqk";
+// indexed by wk | wq << 1 | bk << 2 | bq << 3
+static const char FEN_CASTLE[16][5] = {
+    "-", "K", "Q", "KQ", "k", "Kk", "Qk", "KQk",
+    "q", "Kq", "Qq", "KQq", "kq", "Kkq", "Qkq", "KQkq"
+};
+
+static void _fen_init(void)
+{
+    int             i, b, j, empties;
+
+    for (i=0; i<256; i++) {
+        j = empties = 0;
+        for (b=7; b>=0; b--) {
+            if (i & (1 << b)) {
+                if (empties)
+                    fen_ranks[i][j++] = empties + '0';
+                fen_ranks[i][j++] = '*';
+                empties = 0;
+            } else
+                empties++;
+        }
+        if (empties)
+            fen_ranks[i][j++] = empties + '0';
+        fen_ranks[i][j] = '\0';
+    }
+}
 
-                    CH_DEBUG5("_fen_in: :square: %c%c: str[i]:%c", CHAR_CFILE(s), CHAR_RANK(s), str[i]);
-                    SET_BOARD(bitboard, j);
-                    if (s==enpassant && str[i] != 'p' && str[i] != 'P') {
-                        CH_ERROR("no pawn found for enpassant at %c%c", CHAR_CFILE(s), CHAR_RANK(s));
-                    }
-                    switch(str[i]) {
-                        case 'p': p = BLACK_PAWN; break;
-                        case 'n': p = BLACK_KNIGHT; break;
-                        case 'b': p = BLACK_BISHOP; break;
-                        case 'r': p = BLACK_ROOK; break;
-                        case 'q': p = BLACK_QUEEN; break;
-                        case 'k': p = BLACK_KING; break;
-
-                        case 'P': p = WHITE_PAWN; break;
-                        case 'N': p = WHITE_KNIGHT; break;
-                        case 'B': p = WHITE_BISHOP; break;
-                        case 'R': p = WHITE_ROOK; break;
-                        case 'Q': p = WHITE_QUEEN; break;
-                        case 'K': p = WHITE_KING; break;
-                    }
-                    SET_PIECE(pieces, k, p);
-                    k++;
-                    break;
-                case '1':
-                case '2':
-                case '3':
-                case '4':
-                case '5':
-                case '6':
-                case '7':
-                case '8':
-                          j -= (c - '0');
-                case '/':
-                          break;
-                case ' ':
-                          done=true;
-                          break;
-                default:
-                          CH_ERROR("unkdown character in fen '%c'", c);
-                          break;
+/* writes the fen and its null into str, at most FEN_MAX; returns the length with the null */
+static int _board_fen(const Board * b, char * str)
+{
+    const char      *t;
+    char            *p = str;
+    int             r, k=0;
+    char            s;
+    instr_time      start;
+
+    _stat_start(&start);
+    for (r=7; r>=0; r--) {
+        for (t = fen_ranks[((uint64) b->board >> (r * 8)) & 0xff]; *t; t++) {
+            if (*t == '*') {
+                *p++ = FEN_CHARS[GET_PIECE(b->pieces, k)];
+                k++;
+            } else
+                *p++ = *t;
         }
-        if (k>PIECES_MAX)
-            CH_ERROR("too many pieces in fen");
-        i++;
-        if (done) 
-            break;
-        if (j<-1)
-            CH_ERROR("FEN board is too long");
+        *p++ = r ? '/' : ' ';
+    }
+    *p++ = b->whitesgo ? 'w' : 'b';
+    *p++ = ' ';
+    for (t = FEN_CASTLE[b->wk | b->wq << 1 | b->bk << 2 | b->bq << 3]; *t; t++)
+        *p++ = *t;
+    *p++ = ' ';
+    if (b->enpassant > -1) {
+        // the pawn that can be taken is stored; fen wants the square it passed
+        s = b->enpassant + (TO_RANK(b->enpassant) == 3 ? -8 : 8);
+        *p++ = CHAR_CFILE(s);
+        *p++ = CHAR_RANK(s);
+    } else
+        *p++ = '-';
+    *p++ = '\0';
+    _stat_end(STAT_BOARD_OUT, &start, p - str);
+    return p - str;
+}
+/*}}}*/
+//-------------------------------------------
+//              operators/*{{{*/
+
+Datum
+board_cmp(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_INT32(_board_compare_args(fcinfo));
+}
+
+Datum
+board_sortsupport(PG_FUNCTION_ARGS)
+{
+    SortSupport     ssup = (SortSupport) PG_GETARG_POINTER(0);
+
+    ssup->comparator = _board_fastcmp;
+    if (ssup->abbreviate) {
+        ssup->comparator = ssup_datum_unsigned_cmp;
+        ssup->abbrev_converter = _board_abbrev_convert;
+        ssup->abbrev_abort = _board_abbrev_abort;
+        ssup->abbrev_full_comparator = _board_fastcmp;
     }
+    PG_RETURN_VOID();
+}
 
-    if (j>-1)
-        CH_ERROR("FEN board is too short");
+Datum
+board_eq(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(_board_compare_args(fcinfo) == 0);
+}
 
+Datum
+board_ne(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(_board_compare_args(fcinfo) != 0);
+}
 
-    s1 = k/2 + k%2 ; // pieces size
-    s2 = sizeof(Board);
-    //CH_NOTICE("sizeof board %li sizeof pieces:%li", s2, s1);
-    result = (Board*)palloc(s2 + s1);
-    memset(result, 0, s1+s2);
-    SET_VARSIZE(result, s1+s2);
+Datum
+board_lt(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(_board_compare_args(fcinfo) < 0);
+}
 
-#ifdef EXTRA_DEBUG
-	debug_bitboard(bitboard);
-	strcpy(result->orig_fen, str);
-#endif
+Datum
+board_gt(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(_board_compare_args(fcinfo) > 0);
+}
+
+Datum
+board_le(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(_board_compare_args(fcinfo) <= 0);
+}
+
+Datum
+board_ge(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(_board_compare_args(fcinfo) >= 0);
+}
+
+Datum
+board_hash(PG_FUNCTION_ARGS)
+{
+    instr_time      start;
+    uint64          key;
+
+    _stat_start(&start);
+    key = _board_datum_zobrist(PG_GETARG_DATUM(0));
+    _stat_end(STAT_BOARD_HASH, &start, _board_datum_bytes(PG_GETARG_DATUM(0)));
+	PG_RETURN_UINT32((uint32) key);
+}
+
+Datum
+board_hash_extended(PG_FUNCTION_ARGS)
+{
+	uint64          seed = PG_GETARG_INT64(1);
+	uint64          key;
+    instr_time      start;
+
+    _stat_start(&start);
+    key = _board_datum_zobrist(PG_GETARG_DATUM(0));
+    _stat_end(STAT_BOARD_HASH, &start, _board_datum_bytes(PG_GETARG_DATUM(0)));
+
+    // seed 0 has to agree with board_hash in the low 32 bits
+    if (seed == 0)
+        PG_RETURN_INT64(key);
+    PG_RETURN_DATUM(hash_any_extended((unsigned char *) &key, sizeof(key), seed));
+}
+
+Datum
+zobrist(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_INT64(_board_datum_zobrist(PG_GETARG_DATUM(0)));
+}
+
+/*}}}*/
+//-------------------------------------------
+//              constructors/*{{{*/
+
+/*
+ * FEN piece letters to cpiece_type + 1; zero for anything else.
+ */
+static const unsigned char FEN_PIECE[256] = {
+    ['P'] = WHITE_PAWN + 1, ['N'] = WHITE_KNIGHT + 1, ['B'] = WHITE_BISHOP + 1,
+    ['R'] = WHITE_ROOK + 1, ['Q'] = WHITE_QUEEN + 1,  ['K'] = WHITE_KING + 1,
+    ['p'] = BLACK_PAWN + 1, ['n'] = BLACK_KNIGHT + 1, ['b'] = BLACK_BISHOP + 1,
+    ['r'] = BLACK_ROOK + 1, ['q'] = BLACK_QUEEN + 1,  ['k'] = BLACK_KING + 1,
+};
+
+#define FEN_CHAR(str, len, i) ((i) < (len) ? (unsigned char) (str)[i] : '\0')
+
+/*
+ * Parses the first four fields of a fen in one pass; str does not have to be
+ * null terminated (text) but stops at a null if it is (cstring). Anything
+ * after the enpassant field (the move clocks) is ignored.
+ */
+static Board *_board_parse_fen(const char *str, int len)
+{
+    Board           *result;
+    unsigned char   c, p, pieces[PIECES_MAX];
+    uint64          bitboard=0, pawns=0;
+    int             i=0, j=SQUARE_MAX-1, k=0;
+    bool            wk=false, wq=false, bk=false, bq=false;
+    char            enpassant=-1, whitesgo=-1;
+    instr_time      start;
+
+    _stat_start(&start);
+    memset(pieces, 0, PIECES_MAX);
+
+    // placement: j walks the bitboard from a8 (bit 63) down
+    for (;; i++) {
+        c = FEN_CHAR(str, len, i);
+        if ((p = FEN_PIECE[c])) {
+            if (j < 0)
+                CH_ERROR("FEN board is too long");
+            if (k == PIECES_MAX)
+                CH_ERROR("too many pieces in fen");
+            if (p == WHITE_PAWN + 1 || p == BLACK_PAWN + 1)
+                pawns |= 1ull << j;
+            SET_BOARD(bitboard, j);
+            SET_PIECE(pieces, k, (p - 1));
+            k++;
+        } else if (c >= '1' && c <= '8') {
+            j -= c - '0';
+            if (j < -1)
+                CH_ERROR("FEN board is too long");
+        } else if (c == ' ' || c == '\0') {
+            break;
+        } else if (c != '/') {
+            CH_ERROR("unkdown character in fen '%c'", c);
+        }
+    }
+    if (j > -1)
+        CH_ERROR("FEN board is too short");
 
+    // never step over the end of a truncated fen
+    if (c == '\0')
+        CH_ERROR("missing side field in fen");
+    i++;
+    switch (FEN_CHAR(str, len, i)) {
+        case 'w': whitesgo=1; break;
+        case 'b': whitesgo=0; break;
+        default: CH_ERROR("bad move side in fen"); break;
+    }
+    i++;
+    if (FEN_CHAR(str, len, i) == '\0' || FEN_CHAR(str, len, i + 1) == '\0')
+        CH_ERROR("missing castling field in fen");
+    i++;
+    while ((c = FEN_CHAR(str, len, i)) != '\0' && c != ' ') {
+        switch (c) {
+            case 'K': wk=true; break;
+            case 'Q': wq=true; break;
+            case 'k': bk=true; break;
+            case 'q': bq=true; break;
+            case '-': break;
+            default: CH_ERROR("bad castle availability in fen"); break;
+        }
+        i++;
+    }
+    if (c == '\0' || FEN_CHAR(str, len, i + 1) == '\0')
+        CH_ERROR("missing enpassant field in fen");
+    i++;
+    c = FEN_CHAR(str, len, i);
+    if (c >= 'a' && c <= 'h') {
+        i++;
+        p = FEN_CHAR(str, len, i);
+        if (p != '3' && p != '6')
+            CH_ERROR("bad enpassant rank in fen '%c'", p);
+        // enpassant is set on the capture not on the pawn
+        // so we have have to go up a rank to find the pawn
+        enpassant = _square_in(c, p) + (p=='3' ? 8 : -8);
+        j = TO_SQUARE_IDX(enpassant);
+        if ((bitboard & ~pawns) & (1ull << j))
+            CH_ERROR("no pawn found for enpassant at %c%c", CHAR_CFILE(enpassant), CHAR_RANK(enpassant));
+    } else if (c != '-') {
+        CH_ERROR("bad enpassant in fen: '%c'", c);
+    }
+
+    result = _board_alloc(k);
     result->board = bitboard;
     result->wk = wk;
     result->wq = wq;
@@ -1267,30 +2031,231 @@ board_in(PG_FUNCTION_ARGS)
     result->bq = bq;
     result->enpassant = enpassant;
     result->whitesgo = whitesgo;
-    result->pcount = k;
-    memcpy(result->pieces, pieces, s1);
+    memcpy(result->pieces, pieces, k/2 + k%2);
+    _stat_end(STAT_BOARD_IN, &start, VARSIZE(result));
+    return result;
+}
 
-    /*
-    for (i=0; i<k; i++)
-        CH_DEBUG5("piece %i:0x%08X", i, pieces[i]);
-    */
+Datum
+board_in(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_POINTER(_board_parse_fen(PG_GETARG_CSTRING(0), PG_INT32_MAX));
+}
 
-    PG_RETURN_POINTER(result);
+/*
+ * A type of this extension by name. The types live in the schema of the
+ * calling function, which follows ALTER EXTENSION SET SCHEMA.
+ */
+static Oid _chess_index_type(FunctionCallInfo fcinfo, const char *name)
+{
+    Oid             nsp = get_func_namespace(fcinfo->flinfo->fn_oid);
+    Oid             result = TypenameNspGetTypid(name, nsp);
+
+    if (!OidIsValid(result))
+        CH_ERROR("could not find type %s in schema %s", name, get_namespace_name(nsp));
+    return result;
+}
+
+static void _boards_from_text_error_callback(void *arg)
+{
+    errcontext("boards_from_text element %d", *(int *) arg + 1);
 }
 
+/*
+ * Batch fen to board conversion: one call instead of a cast per row, and no
+ * cstring copy of each element. Nulls stay null.
+ */
 Datum
-board_out(PG_FUNCTION_ARGS)
+boards_from_text(PG_FUNCTION_ARGS)
 {
+    ArrayType       *fens = PG_GETARG_ARRAYTYPE_P(0);
+    Oid             board_oid = _chess_index_type(fcinfo, "board");
+    Datum           *elems;
+    bool            *nulls;
+    text            *fen;
+    int             n, i=0;
+    ErrorContextCallback errcallback;
+
+    deconstruct_array(fens, TEXTOID, -1, false, TYPALIGN_INT, &elems, &nulls, &n);
+
+    errcallback.callback = _boards_from_text_error_callback;
+    errcallback.arg = &i;
+    errcallback.previous = error_context_stack;
+    error_context_stack = &errcallback;
+    for (; i<n; i++) {
+        if (nulls[i])
+            continue;
+        fen = DatumGetTextPP(elems[i]);
+        elems[i] = PointerGetDatum(_board_parse_fen(VARDATA_ANY(fen), VARSIZE_ANY_EXHDR(fen)));
+    }
+    error_context_stack = errcallback.previous;
+
+    PG_RETURN_ARRAYTYPE_P(construct_md_array(elems, nulls, ARR_NDIM(fens), ARR_DIMS(fens),
+                ARR_LBOUND(fens), board_oid, -1, false, TYPALIGN_DOUBLE));
+}
 
-    const Board     *b = (Board *) PG_GETARG_POINTER(0);
-    char            str[FEN_MAX], n;
-    char            *result;
+Datum
+board_out(PG_FUNCTION_ARGS)
+{
+    char            *result = (char *) palloc(FEN_MAX);
 
-    n = _board_fen(b, str);
-    result = (char *)palloc(n);
-    memcpy(result, str, n);
+    _board_fen(PG_GETARG_BOARD(0), result);
     PG_RETURN_CSTRING(result);
 }
+
+#define EXPORT_FETCH 1000
+#define EXPORT_BUFFER (1 << 20)
+
+/*
+ * Writes the board in the first column of each row of query to a server side
+ * file (an absolute path), one per line, and returns the number written (null boards are
+ * skipped). Rows come through a cursor and are rendered straight into the
+ * file buffer. Boards have no move clocks, so fen lines end in "0 1"; epd
+ * lines are the four fields.
+ */
+Datum
+export_fen(PG_FUNCTION_ARGS)
+{
+    char            *query = text_to_cstring(PG_GETARG_TEXT_PP(0));
+    char            *path = text_to_cstring(PG_GETARG_TEXT_PP(1));
+    bool            epd = PG_GETARG_BOOL(2);
+    char            line[FEN_MAX + 5];
+    MemoryContext   rowcontext, oldcontext;
+    Portal          portal;
+    Oid             board_type;
+    FILE            *file;
+    Datum           d;
+    bool            isnull;
+    int64           rows=0;
+    uint64          i;
+    size_t          n;
+
+    if (!has_privs_of_role(GetUserId(), ROLE_PG_WRITE_SERVER_FILES))
+        ereport(ERROR, (errcode(ERRCODE_INSUFFICIENT_PRIVILEGE),
+                    errmsg("must be superuser or a member of pg_write_server_files to export to a file")));
+
+    // as COPY TO: a relative path would land in the data directory
+    if (!is_absolute_path(path))
+        ereport(ERROR, (errcode(ERRCODE_INVALID_NAME),
+                    errmsg("relative path not allowed for export_fen")));
+
+    board_type = _chess_index_type(fcinfo, "board");
+    if (SPI_connect() != SPI_OK_CONNECT)
+        CH_ERROR("export_fen: SPI_connect failed");
+    portal = SPI_cursor_open_with_args(NULL, query, 0, NULL, NULL, NULL, true, 0);
+    if (portal->tupDesc == NULL || portal->tupDesc->natts < 1
+            || TupleDescAttr(portal->tupDesc, 0)->atttypid != board_type)
+        CH_ERROR("export_fen: the first column of the query must be a board");
+
+    file = AllocateFile(path, PG_BINARY_W);
+    if (file == NULL)
+        ereport(ERROR, (errcode_for_file_access(),
+                    errmsg("could not open file \"%s\" for writing: %m", path)));
+    setvbuf(file, NULL, _IOFBF, EXPORT_BUFFER);
+
+    rowcontext = AllocSetContextCreate(CurrentMemoryContext, "export_fen rows", ALLOCSET_DEFAULT_SIZES);
+    for (;;) {
+        SPI_cursor_fetch(portal, true, EXPORT_FETCH);
+        if (SPI_processed == 0)
+            break;
+        oldcontext = MemoryContextSwitchTo(rowcontext);
+        for (i=0; i<SPI_processed; i++) {
+            d = SPI_getbinval(SPI_tuptable->vals[i], SPI_tuptable->tupdesc, 1, &isnull);
+            if (isnull)
+                continue;
+            n = _board_fen(_board_get(d), line) - 1;
+            if (!epd) {
+                memcpy(line + n, " 0 1", 4);
+                n += 4;
+            }
+            line[n++] = '\n';
+            if (fwrite(line, 1, n, file) != n)
+                ereport(ERROR, (errcode_for_file_access(),
+                            errmsg("could not write file \"%s\": %m", path)));
+            rows++;
+        }
+        MemoryContextSwitchTo(oldcontext);
+        MemoryContextReset(rowcontext);
+        SPI_freetuptable(SPI_tuptable);
+        CHECK_FOR_INTERRUPTS();
+    }
+
+    if (FreeFile(file) != 0)
+        ereport(ERROR, (errcode_for_file_access(),
+                    errmsg("could not close file \"%s\": %m", path)));
+    SPI_cursor_close(portal);
+    SPI_finish();
+    PG_RETURN_INT64(rows);
+}
+
+/*
+ * binary format, version 1:
+ *  byte    version
+ *  byte    flags: whitesgo, wk, wq, bk, bq from the low bit up
+ *  byte    enpassant: square of the pawn that can be taken or -1
+ *  int64   bitboard
+ *  bytes   piece nibbles, popcount(bitboard)/2 rounded up
+ */
+Datum
+board_recv(PG_FUNCTION_ARGS)
+{
+    StringInfo      buf = (StringInfo) PG_GETARG_POINTER(0);
+    Board           *result;
+    int             version, flags, enpassant, i;
+    int64           bitboard;
+    unsigned char   k;
+
+    version = pq_getmsgbyte(buf);
+    if (version != BOARD_SEND_VERSION)
+        BAD_TYPE_RECV("board version", version);
+    flags = pq_getmsgbyte(buf);
+    if (flags & ~0x1f)
+        BAD_TYPE_RECV("board flags", flags);
+    enpassant = (signed char) pq_getmsgbyte(buf);
+    if (enpassant < -1 || enpassant >= SQUARE_MAX)
+        BAD_TYPE_RECV("board enpassant", enpassant);
+    bitboard = pq_getmsgint64(buf);
+    k = pg_popcount64(bitboard);
+    if (k > PIECES_MAX)
+        BAD_TYPE_RECV("board piece count", k);
+
+    result = _board_alloc(k);
+    pq_copymsgbytes(buf, (char *) result->pieces, k/2 + k%2);
+    for (i=0; i<k; i++)
+        if (GET_PIECE(result->pieces, i) >= CPIECE_MAX)
+            BAD_TYPE_RECV("board piece", GET_PIECE(result->pieces, i));
+    if (k%2 && GET_PIECE(result->pieces, k))
+        BAD_TYPE_RECV("board padding", GET_PIECE(result->pieces, k));
+
+    result->board = bitboard;
+    result->whitesgo = flags & 0x01 ? 1 : 0;
+    result->wk = flags & 0x02 ? 1 : 0;
+    result->wq = flags & 0x04 ? 1 : 0;
+    result->bk = flags & 0x08 ? 1 : 0;
+    result->bq = flags & 0x10 ? 1 : 0;
+    result->enpassant = enpassant;
+    // as board_in: the pawn that just moved two squares, so it prints back as a fen
+    if (enpassant != -1 && (TO_RANK(enpassant) != (result->whitesgo ? 4 : 3)
+                || _board_piece_at(result, enpassant) != (result->whitesgo ? BLACK_PAWN : WHITE_PAWN)))
+        BAD_TYPE_RECV("board enpassant", enpassant);
+
+    PG_RETURN_POINTER(result);
+}
+
+Datum
+board_send(PG_FUNCTION_ARGS)
+{
+    const Board     *b = PG_GETARG_BOARD(0);
+    StringInfoData  buf;
+
+    pq_begintypsend(&buf);
+    pq_sendbyte(&buf, BOARD_SEND_VERSION);
+    pq_sendbyte(&buf, b->whitesgo | b->wk << 1 | b->wq << 2 | b->bk << 3 | b->bq << 4);
+    pq_sendbyte(&buf, (unsigned char) b->enpassant);
+    pq_sendint64(&buf, b->board);
+    pq_sendbytes(&buf, (char *) b->pieces, b->pcount/2 + b->pcount%2);
+    PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
 /*}}}*/
 //-------------------------------------------
 //              functions/*{{{*/
@@ -1298,24 +2263,88 @@ board_out(PG_FUNCTION_ARGS)
 Datum
 pcount(PG_FUNCTION_ARGS)
 {
-    const Board     *b = (Board *) PG_GETARG_POINTER(0);
+    const Board     *b = PG_GETARG_BOARD(0);
     PG_RETURN_CSTRING(b->pcount);
 }
 
 Datum
 side(PG_FUNCTION_ARGS)
 {
-    const Board     *b = (Board *) PG_GETARG_POINTER(0);
+    const Board     *b = PG_GETARG_BOARD(0);
     PG_RETURN_CHAR(b->whitesgo ? WHITE : BLACK);
 }
 
+/* the castling field of the fen: KQkq, or - for none */
+Datum
+castling(PG_FUNCTION_ARGS)
+{
+    const Board     *b = PG_GETARG_BOARD(0);
+    char            result[CASTLE_MAX + 1];
+    int             j=0;
+
+    if (b->wk) result[j++] = 'K';
+    if (b->wq) result[j++] = 'Q';
+    if (b->bk) result[j++] = 'k';
+    if (b->bq) result[j++] = 'q';
+    if (!j) result[j++] = '-';
+    result[j] = '\0';
+    PG_RETURN_TEXT_P(cstring_to_text(result));
+}
+
+/* null for an empty square */
+Datum
+piece_at(PG_FUNCTION_ARGS)
+{
+    const Board     *b = PG_GETARG_BOARD(0);
+    int             p = _board_piece_at(b, PG_GETARG_CHAR(1));
+
+    if (p < 0)
+        PG_RETURN_NULL();
+    PG_RETURN_CHAR(p);
+}
+
 Datum
 pieces(PG_FUNCTION_ARGS)
 {
-    const Board     *b = (Board *) PG_GETARG_POINTER(0);
     const side_type go = PG_GETARG_CHAR(1);
+    uint64          m = _board_datum_material(PG_GETARG_DATUM(0));
+
+    if (!m)
+        CH_ERROR("board has no pieces");
+    PG_RETURN_INT16(_material_pindex(m, go));
+}
+
+Datum
+material(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_INT64(_board_datum_material(PG_GETARG_DATUM(0)));
+}
+
+Datum
+pawns(PG_FUNCTION_ARGS)
+{
+    PawnKey         *result = (PawnKey *) palloc(sizeof(PawnKey));
+
+    _board_datum_pawns(PG_GETARG_DATUM(0), result);
+    PG_RETURN_POINTER(result);
+}
+
+Datum
+board_upgrade(PG_FUNCTION_ARGS)
+{
+    const Board     *b = PG_GETARG_BOARD(0);
 
-    PG_RETURN_INT16(_pindex_in(_board_pieces(b, go)));
+    if ((Pointer) b != PG_GETARG_POINTER(0))
+        PG_RETURN_POINTER(b);
+    PG_RETURN_POINTER(PG_DETOAST_DATUM_COPY(PG_GETARG_DATUM(0)));
+}
+
+/* the stored version, without upgrading */
+Datum
+board_version(PG_FUNCTION_ARGS)
+{
+    const Board     *b = (Board *) PG_DETOAST_DATUM(PG_GETARG_DATUM(0));
+    PG_RETURN_INT32(b->version);
 }
 
 /*}}}*/
@@ -1423,6 +2452,17 @@ piecesquare_out(PG_FUNCTION_ARGS)
 	PG_RETURN_CSTRING(result);
 }
 
+Datum
+piecesquare_recv(PG_FUNCTION_ARGS)
+{
+    StringInfo      buf = (StringInfo) PG_GETARG_POINTER(0);
+    unsigned int    ps = pq_getmsgint(buf, sizeof(int16));
+
+    if (GET_PS_SQUARE(ps) >= SQUARE_MAX || GET_PS_PIECE(ps) >= CPIECE_MAX)
+        BAD_TYPE_RECV("piecesquare", ps);
+    PG_RETURN_INT16(ps);
+}
+
 Datum
 piecesquare_square(PG_FUNCTION_ARGS)
 {
@@ -1437,6 +2477,3333 @@ piecesquare_piece(PG_FUNCTION_ARGS)
 	uint16			ps = PG_GETARG_UINT16(0);
 	PG_RETURN_CHAR((char)GET_PS_PIECE(ps));
 }
+/********************************************************
+ * 		board gin: piecesquare keys
+ ********************************************************/
+/*{{{*/
+
+static int16 *_piecesquare_array(ArrayType *a, int *n)
+{
+    if (ARR_NDIM(a) > 1)
+        CH_ERROR("piecesquare array must be one dimensional");
+    if (array_contains_nulls(a))
+        CH_ERROR("piecesquare array must not contain nulls");
+    *n = ArrayGetNItems(ARR_NDIM(a), ARR_DIMS(a));
+    return (int16 *) ARR_DATA_PTR(a);
+}
+
+Datum
+board_contains(PG_FUNCTION_ARGS)
+{
+    const Board     *b = PG_GETARG_BOARD(0);
+    ArrayType       *a = PG_GETARG_ARRAYTYPE_P(1);
+    int16           *ps;
+    int             i, n;
+
+    ps = _piecesquare_array(a, &n);
+    for (i=0; i<n; i++)
+        if (_board_piece_at(b, GET_PS_SQUARE(ps[i])) != GET_PS_PIECE(ps[i]))
+            PG_RETURN_BOOL(false);
+    PG_RETURN_BOOL(true);
+}
+
+Datum
+board_overlaps(PG_FUNCTION_ARGS)
+{
+    const Board     *b = PG_GETARG_BOARD(0);
+    ArrayType       *a = PG_GETARG_ARRAYTYPE_P(1);
+    int16           *ps;
+    int             i, n;
+
+    ps = _piecesquare_array(a, &n);
+    for (i=0; i<n; i++)
+        if (_board_piece_at(b, GET_PS_SQUARE(ps[i])) == GET_PS_PIECE(ps[i]))
+            PG_RETURN_BOOL(true);
+    PG_RETURN_BOOL(false);
+}
+
+CH_STAT_FUNCTION(STAT_GIN, board_gin_extract_value)
+static Datum
+_board_gin_extract_value(PG_FUNCTION_ARGS)
+{
+    const Board     *b = PG_GETARG_BOARD(0);
+    int32           *nkeys = (int32 *) PG_GETARG_POINTER(1);
+    Datum           *keys = (Datum *) palloc(sizeof(Datum) * PIECES_MAX);
+    int16           ps[PIECES_MAX];
+    int             i;
+
+    *nkeys = _board_piecesquares(b, ps);
+    for (i=0; i<*nkeys; i++)
+        keys[i] = Int16GetDatum(ps[i]);
+    PG_RETURN_POINTER(keys);
+}
+
+CH_STAT_FUNCTION(STAT_GIN, board_gin_extract_query)
+static Datum
+_board_gin_extract_query(PG_FUNCTION_ARGS)
+{
+    ArrayType       *a = PG_GETARG_ARRAYTYPE_P(0);
+    int32           *nkeys = (int32 *) PG_GETARG_POINTER(1);
+    StrategyNumber  strategy = PG_GETARG_UINT16(2);
+    int32           *searchMode = (int32 *) PG_GETARG_POINTER(6);
+    Datum           *keys;
+    int16           *ps;
+    int             i, n;
+
+    ps = _piecesquare_array(a, &n);
+    keys = (Datum *) palloc(sizeof(Datum) * (n + 1));
+    for (i=0; i<n; i++)
+        keys[i] = Int16GetDatum(ps[i]);
+    *nkeys = n;
+
+    // every board contains the empty set, none overlap it
+    if (n == 0 && strategy == GIN_CONTAINS_STRATEGY)
+        *searchMode = GIN_SEARCH_MODE_ALL;
+    PG_RETURN_POINTER(keys);
+}
+
+/* keys are exact so there is never a recheck */
+CH_STAT_FUNCTION(STAT_GIN, board_gin_consistent)
+static Datum
+_board_gin_consistent(PG_FUNCTION_ARGS)
+{
+    bool            *check = (bool *) PG_GETARG_POINTER(0);
+    StrategyNumber  strategy = PG_GETARG_UINT16(1);
+    int32           nkeys = PG_GETARG_INT32(3);
+    bool            *recheck = (bool *) PG_GETARG_POINTER(5);
+    int             i;
+
+    *recheck = false;
+    switch (strategy) {
+        case GIN_OVERLAP_STRATEGY:
+            for (i=0; i<nkeys; i++)
+                if (check[i])
+                    PG_RETURN_BOOL(true);
+            PG_RETURN_BOOL(false);
+        case GIN_CONTAINS_STRATEGY:
+            for (i=0; i<nkeys; i++)
+                if (!check[i])
+                    PG_RETURN_BOOL(false);
+            PG_RETURN_BOOL(true);
+        default:
+            CH_ERROR("board_gin_consistent: unknown strategy number: %d", strategy);
+    }
+    PG_RETURN_BOOL(false);
+}
+
+CH_STAT_FUNCTION(STAT_GIN, board_gin_triconsistent)
+static Datum
+_board_gin_triconsistent(PG_FUNCTION_ARGS)
+{
+    GinTernaryValue *check = (GinTernaryValue *) PG_GETARG_POINTER(0);
+    StrategyNumber  strategy = PG_GETARG_UINT16(1);
+    int32           nkeys = PG_GETARG_INT32(3);
+    GinTernaryValue result;
+    int             i;
+
+    switch (strategy) {
+        case GIN_OVERLAP_STRATEGY:
+            result = GIN_FALSE;
+            for (i=0; i<nkeys; i++) {
+                if (check[i] == GIN_TRUE)
+                    PG_RETURN_GIN_TERNARY_VALUE(GIN_TRUE);
+                if (check[i] == GIN_MAYBE)
+                    result = GIN_MAYBE;
+            }
+            break;
+        case GIN_CONTAINS_STRATEGY:
+            result = GIN_TRUE;
+            for (i=0; i<nkeys; i++) {
+                if (check[i] == GIN_FALSE)
+                    PG_RETURN_GIN_TERNARY_VALUE(GIN_FALSE);
+                if (check[i] == GIN_MAYBE)
+                    result = GIN_MAYBE;
+            }
+            break;
+        default:
+            CH_ERROR("board_gin_triconsistent: unknown strategy number: %d", strategy);
+    }
+    PG_RETURN_GIN_TERNARY_VALUE(result);
+}
+/*}}}*/
+/********************************************************
+ * 		pawnkey: pawn structure
+ ********************************************************/
+/*{{{*/
+
+/* the pawn rows of a fen: '8/pppppppp/8/8/8/8/PPPPPPPP/8' */
+Datum
+pawnkey_in(PG_FUNCTION_ARGS)
+{
+    char            *str = PG_GETARG_CSTRING(0);
+    PawnKey         *result = (PawnKey *) palloc0(sizeof(PawnKey));
+    int             rank = 7, file = 0;
+    char            *c;
+
+    for (c=str; *c; c++) {
+        if (*c == '/') {
+            if (file != 8 || rank == 0)
+                BAD_TYPE_IN("pawnkey", str);
+            rank--;
+            file = 0;
+        } else if (*c >= '1' && *c <= '8') {
+            file += *c - '0';
+        } else if ((*c == 'P' || *c == 'p') && file < 8) {
+            result->pawns[*c == 'P' ? WHITE : BLACK] |= 1ull << (rank * 8 + file);
+            file++;
+        } else
+            BAD_TYPE_IN("pawnkey", str);
+        if (file > 8)
+            BAD_TYPE_IN("pawnkey", str);
+    }
+    if (file != 8 || rank != 0)
+        BAD_TYPE_IN("pawnkey", str);
+    PG_RETURN_POINTER(result);
+}
+
+Datum
+pawnkey_out(PG_FUNCTION_ARGS)
+{
+    const PawnKey   *key = PG_GETARG_PAWNKEY(0);
+    char            *result = palloc(SQUARE_MAX + 8);
+    int             rank, file, j=0, empties;
+    uint64          bit;
+
+    for (rank=7; rank>=0; rank--) {
+        empties = 0;
+        for (file=0; file<8; file++) {
+            bit = 1ull << (rank * 8 + file);
+            if (!((key->pawns[WHITE] | key->pawns[BLACK]) & bit)) {
+                empties++;
+                continue;
+            }
+            if (empties)
+                result[j++] = '0' + empties;
+            empties = 0;
+            result[j++] = key->pawns[WHITE] & bit ? 'P' : 'p';
+        }
+        if (empties)
+            result[j++] = '0' + empties;
+        if (rank)
+            result[j++] = '/';
+    }
+    result[j] = '\0';
+    PG_RETURN_CSTRING(result);
+}
+
+/* binary format: int64 white pawns, int64 black pawns */
+Datum
+pawnkey_recv(PG_FUNCTION_ARGS)
+{
+    StringInfo      buf = (StringInfo) PG_GETARG_POINTER(0);
+    PawnKey         *result = (PawnKey *) palloc(sizeof(PawnKey));
+
+    result->pawns[WHITE] = pq_getmsgint64(buf);
+    result->pawns[BLACK] = pq_getmsgint64(buf);
+    if (result->pawns[WHITE] & result->pawns[BLACK])
+        BAD_TYPE_RECV("pawnkey", pg_popcount64(result->pawns[WHITE] & result->pawns[BLACK]));
+    PG_RETURN_POINTER(result);
+}
+
+Datum
+pawnkey_send(PG_FUNCTION_ARGS)
+{
+    const PawnKey   *key = PG_GETARG_PAWNKEY(0);
+    StringInfoData  buf;
+
+    pq_begintypsend(&buf);
+    pq_sendint64(&buf, key->pawns[WHITE]);
+    pq_sendint64(&buf, key->pawns[BLACK]);
+    PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+/* white pawns then black pawns, as unsigned */
+static int _pawnkey_compare(const PawnKey *a, const PawnKey *b)
+{
+    if (a->pawns[WHITE] != b->pawns[WHITE])
+        return a->pawns[WHITE] < b->pawns[WHITE] ? -1 : 1;
+    if (a->pawns[BLACK] != b->pawns[BLACK])
+        return a->pawns[BLACK] < b->pawns[BLACK] ? -1 : 1;
+    return 0;
+}
+
+#define PAWNKEY_COMPARE_ARGS() _pawnkey_compare(PG_GETARG_PAWNKEY(0), PG_GETARG_PAWNKEY(1))
+
+Datum
+pawnkey_cmp(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_INT32(PAWNKEY_COMPARE_ARGS());
+}
+
+Datum
+pawnkey_eq(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(PAWNKEY_COMPARE_ARGS() == 0);
+}
+
+Datum
+pawnkey_ne(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(PAWNKEY_COMPARE_ARGS() != 0);
+}
+
+Datum
+pawnkey_lt(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(PAWNKEY_COMPARE_ARGS() < 0);
+}
+
+Datum
+pawnkey_gt(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(PAWNKEY_COMPARE_ARGS() > 0);
+}
+
+Datum
+pawnkey_le(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(PAWNKEY_COMPARE_ARGS() <= 0);
+}
+
+Datum
+pawnkey_ge(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(PAWNKEY_COMPARE_ARGS() >= 0);
+}
+
+Datum
+pawnkey_hash(PG_FUNCTION_ARGS)
+{
+    return hash_any((unsigned char *) PG_GETARG_PAWNKEY(0), sizeof(PawnKey));
+}
+
+Datum
+pawnkey_hash_extended(PG_FUNCTION_ARGS)
+{
+    return hash_any_extended((unsigned char *) PG_GETARG_PAWNKEY(0), sizeof(PawnKey), PG_GETARG_INT64(1));
+}
+
+/* every pawn of b is on the same square in a */
+static bool _pawnkey_contains(const PawnKey *a, const PawnKey *b)
+{
+    return (a->pawns[WHITE] & b->pawns[WHITE]) == b->pawns[WHITE]
+        && (a->pawns[BLACK] & b->pawns[BLACK]) == b->pawns[BLACK];
+}
+
+Datum
+pawnkey_contains(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(_pawnkey_contains(PG_GETARG_PAWNKEY(0), PG_GETARG_PAWNKEY(1)));
+}
+
+Datum
+pawnkey_contained(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(_pawnkey_contains(PG_GETARG_PAWNKEY(1), PG_GETARG_PAWNKEY(0)));
+}
+
+/*
+ * gin keys: one int2 per pawn, the square plus 64 for a white pawn. At
+ * most 16 per side in a legal position, but any board may be indexed.
+ */
+static Datum *_pawnkey_gin_keys(const PawnKey *key, int32 *nkeys)
+{
+    Datum           *keys = (Datum *) palloc(sizeof(Datum) * (pg_popcount64(key->pawns[WHITE]) + pg_popcount64(key->pawns[BLACK]) + 1));
+    uint64          bb;
+    int             side, n = 0;
+
+    for (side=BLACK; side<=WHITE; side++)
+        for (bb = key->pawns[side]; bb; bb &= bb - 1)
+            keys[n++] = Int16GetDatum(side * SQUARE_MAX + pg_rightmost_one_pos64(bb));
+    *nkeys = n;
+    return keys;
+}
+
+Datum
+pawnkey_gin_extract_value(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_POINTER(_pawnkey_gin_keys(PG_GETARG_PAWNKEY(0), (int32 *) PG_GETARG_POINTER(1)));
+}
+
+Datum
+pawnkey_gin_extract_query(PG_FUNCTION_ARGS)
+{
+    int32           *nkeys = (int32 *) PG_GETARG_POINTER(1);
+    StrategyNumber  strategy = PG_GETARG_UINT16(2);
+    int32           *searchMode = (int32 *) PG_GETARG_POINTER(6);
+    Datum           *keys = _pawnkey_gin_keys(PG_GETARG_PAWNKEY(0), nkeys);
+
+    switch (strategy) {
+        case GIN_CONTAINS_STRATEGY:
+            if (*nkeys == 0)
+                *searchMode = GIN_SEARCH_MODE_ALL;
+            break;
+        case GIN_CONTAINED_STRATEGY:
+            // keys without pawns have no entries
+            *searchMode = GIN_SEARCH_MODE_INCLUDE_EMPTY;
+            break;
+        case GIN_EQUAL_STRATEGY:
+            if (*nkeys == 0)
+                *searchMode = GIN_SEARCH_MODE_INCLUDE_EMPTY;
+            break;
+        default:
+            CH_ERROR("pawnkey_gin_extract_query: unknown strategy number: %d", strategy);
+    }
+    PG_RETURN_POINTER(keys);
+}
+
+/*
+ * Only containment is decided by the index; an item matching some or all
+ * of the query pawns may still have pawns of its own for <@ and =.
+ */
+Datum
+pawnkey_gin_consistent(PG_FUNCTION_ARGS)
+{
+    bool            *check = (bool *) PG_GETARG_POINTER(0);
+    StrategyNumber  strategy = PG_GETARG_UINT16(1);
+    int32           nkeys = PG_GETARG_INT32(3);
+    bool            *recheck = (bool *) PG_GETARG_POINTER(5);
+    int             i;
+
+    *recheck = strategy != GIN_CONTAINS_STRATEGY;
+    if (strategy == GIN_CONTAINED_STRATEGY)
+        PG_RETURN_BOOL(true);
+    for (i=0; i<nkeys; i++)
+        if (!check[i])
+            PG_RETURN_BOOL(false);
+    PG_RETURN_BOOL(true);
+}
+
+Datum
+pawnkey_gin_triconsistent(PG_FUNCTION_ARGS)
+{
+    GinTernaryValue *check = (GinTernaryValue *) PG_GETARG_POINTER(0);
+    StrategyNumber  strategy = PG_GETARG_UINT16(1);
+    int32           nkeys = PG_GETARG_INT32(3);
+    GinTernaryValue result = strategy == GIN_CONTAINS_STRATEGY ? GIN_TRUE : GIN_MAYBE;
+    int             i;
+
+    if (strategy == GIN_CONTAINED_STRATEGY)
+        PG_RETURN_GIN_TERNARY_VALUE(GIN_MAYBE);
+    for (i=0; i<nkeys; i++) {
+        if (check[i] == GIN_FALSE)
+            PG_RETURN_GIN_TERNARY_VALUE(GIN_FALSE);
+        if (check[i] == GIN_MAYBE)
+            result = GIN_MAYBE;
+    }
+    PG_RETURN_GIN_TERNARY_VALUE(result);
+}
+/*}}}*/
+/********************************************************
+ * 		board gist: piece type signatures
+ ********************************************************/
+/*{{{*/
+
+static BoardSig *_boardsig_new(void)
+{
+    BoardSig        *result = (BoardSig *) palloc0(sizeof(BoardSig));
+
+    SET_VARSIZE(result, sizeof(BoardSig));
+    return result;
+}
+
+static void _boardsig_union(BoardSig *a, const BoardSig *b)
+{
+    int             i;
+
+    for (i=0; i<CPIECE_MAX; i++)
+        a->masks[i] |= b->masks[i];
+    a->flags = 0;
+}
+
+/* bits of b that are not in a */
+static int _boardsig_missing(const BoardSig *a, const BoardSig *b)
+{
+    int             i, result=0;
+
+    for (i=0; i<CPIECE_MAX; i++)
+        result += pg_popcount64(b->masks[i] & ~a->masks[i]);
+    return result;
+}
+
+static int _boardsig_hamming(const BoardSig *a, const BoardSig *b)
+{
+    int             i, result=0;
+
+    for (i=0; i<CPIECE_MAX; i++)
+        result += pg_popcount64(a->masks[i] ^ b->masks[i]);
+    return result;
+}
+
+static void _boardsig_set(BoardSig *sig, const Board *b)
+{
+    SET_VARSIZE(sig, sizeof(BoardSig));
+    sig->flags = _board_state(b) | BOARDSIG_LEAF;
+    _board_masks(b, sig->masks);
+}
+
+/*
+ * Side to move and each castling right count one, as does a different
+ * enpassant square.
+ */
+static int _boardsig_state_distance(int a, int b)
+{
+    return pg_popcount32((a ^ b) & 0xf80) + ((a & 0x7f) != (b & 0x7f));
+}
+
+/*
+ * Leaves give the exact distance. An inner key can only bound its leaves
+ * from below: every query bit missing from the union is a mismatch in
+ * any leaf under it, and the state is unknown.
+ */
+static int _boardsig_distance(const BoardSig *key, const BoardSig *query)
+{
+    if (!(key->flags & BOARDSIG_LEAF))
+        return _boardsig_missing(key, query);
+    return _boardsig_hamming(key, query) + _boardsig_state_distance(key->flags, query->flags);
+}
+
+Datum
+boardsig_in(PG_FUNCTION_ARGS)
+{
+    ereport(ERROR, (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+                errmsg("cannot accept a value of type boardsig")));
+    PG_RETURN_VOID();
+}
+
+Datum
+boardsig_out(PG_FUNCTION_ARGS)
+{
+    const BoardSig  *sig = PG_GETARG_BOARDSIG(0);
+    char            *result = palloc(CPIECE_MAX * 17 + 1);
+    int             i, j=0;
+
+    for (i=0; i<CPIECE_MAX; i++)
+        j += sprintf(result + j, "%s%016" INT64_MODIFIER "x", i ? "," : "", sig->masks[i]);
+    PG_RETURN_CSTRING(result);
+}
+
+Datum
+board_contains_board(PG_FUNCTION_ARGS)
+{
+    const Board     *a = PG_GETARG_BOARD(0);
+    const Board     *b = PG_GETARG_BOARD(1);
+    PG_RETURN_BOOL(_board_contains_board(a, b));
+}
+
+Datum
+board_contained_board(PG_FUNCTION_ARGS)
+{
+    const Board     *a = PG_GETARG_BOARD(0);
+    const Board     *b = PG_GETARG_BOARD(1);
+    PG_RETURN_BOOL(_board_contains_board(b, a));
+}
+
+/*
+ * The query masks are kept in fn_extra for the scan, compared by value
+ * since a rescan may hand in a new query at the same address.
+ */
+typedef struct {
+    Board                 *query;
+    BoardSig              sig;
+} BoardSigCache;
+
+static const BoardSig *_boardsig_query(FunctionCallInfo fcinfo, const Board *query)
+{
+    BoardSigCache   *cache = (BoardSigCache *) fcinfo->flinfo->fn_extra;
+
+    if (cache == NULL) {
+        cache = MemoryContextAllocZero(fcinfo->flinfo->fn_mcxt, sizeof(BoardSigCache));
+        cache->query = MemoryContextAlloc(fcinfo->flinfo->fn_mcxt, sizeof(Board) + PIECES_MAX/2);
+        fcinfo->flinfo->fn_extra = cache;
+    } else if (VARSIZE(cache->query) == VARSIZE(query)
+            && memcmp(cache->query, query, VARSIZE(query)) == 0) {
+        return &cache->sig;
+    }
+    memcpy(cache->query, query, VARSIZE(query));
+    _boardsig_set(&cache->sig, query);
+    return &cache->sig;
+}
+
+CH_STAT_FUNCTION(STAT_GIST, board_gist_consistent)
+static Datum
+_board_gist_consistent(PG_FUNCTION_ARGS)
+{
+    GISTENTRY       *entry = (GISTENTRY *) PG_GETARG_POINTER(0);
+    const Board     *query = PG_GETARG_BOARD(1);
+    StrategyNumber  strategy = (StrategyNumber) PG_GETARG_UINT16(2);
+    bool            *recheck = (bool *) PG_GETARG_POINTER(4);
+    const BoardSig  *key = (BoardSig *) DatumGetPointer(entry->key);
+
+    // masks are exact on the leaves
+    *recheck = false;
+    switch (strategy) {
+        case RTContainsStrategyNumber:
+            PG_RETURN_BOOL(_boardsig_missing(key, _boardsig_query(fcinfo, query)) == 0);
+        default:
+            CH_ERROR("board_gist_consistent: unknown strategy number: %d", strategy);
+    }
+    PG_RETURN_BOOL(false);
+}
+
+CH_STAT_FUNCTION(STAT_GIST, board_gist_union)
+static Datum
+_board_gist_union(PG_FUNCTION_ARGS)
+{
+    GistEntryVector *entryvec = (GistEntryVector *) PG_GETARG_POINTER(0);
+    int             *size = (int *) PG_GETARG_POINTER(1);
+    BoardSig        *result = _boardsig_new();
+    int             i;
+
+    for (i=0; i<entryvec->n; i++)
+        _boardsig_union(result, (BoardSig *) DatumGetPointer(entryvec->vector[i].key));
+    *size = sizeof(BoardSig);
+    PG_RETURN_POINTER(result);
+}
+
+CH_STAT_FUNCTION(STAT_GIST, board_gist_compress)
+static Datum
+_board_gist_compress(PG_FUNCTION_ARGS)
+{
+    GISTENTRY       *entry = (GISTENTRY *) PG_GETARG_POINTER(0);
+    GISTENTRY       *retval;
+    const Board     *b;
+    BoardSig        *sig;
+
+    if (!entry->leafkey)
+        PG_RETURN_POINTER(entry);
+
+    b = _board_get(entry->key);
+    sig = _boardsig_new();
+    _boardsig_set(sig, b);
+
+    retval = (GISTENTRY *) palloc(sizeof(GISTENTRY));
+    gistentryinit(*retval, PointerGetDatum(sig), entry->rel, entry->page, entry->offset, false);
+    PG_RETURN_POINTER(retval);
+}
+
+/* the number of bits the union would grow by */
+CH_STAT_FUNCTION(STAT_GIST, board_gist_penalty)
+static Datum
+_board_gist_penalty(PG_FUNCTION_ARGS)
+{
+    GISTENTRY       *origentry = (GISTENTRY *) PG_GETARG_POINTER(0);
+    GISTENTRY       *newentry = (GISTENTRY *) PG_GETARG_POINTER(1);
+    float           *penalty = (float *) PG_GETARG_POINTER(2);
+
+    *penalty = _boardsig_missing((BoardSig *) DatumGetPointer(origentry->key),
+                                 (BoardSig *) DatumGetPointer(newentry->key));
+    PG_RETURN_POINTER(penalty);
+}
+
+/*
+ * Seed the two pages with the pair that differs the most, then give every
+ * other entry to the side whose union grows the least.
+ */
+CH_STAT_FUNCTION(STAT_GIST, board_gist_picksplit)
+static Datum
+_board_gist_picksplit(PG_FUNCTION_ARGS)
+{
+    GistEntryVector *entryvec = (GistEntryVector *) PG_GETARG_POINTER(0);
+    GIST_SPLITVEC   *v = (GIST_SPLITVEC *) PG_GETARG_POINTER(1);
+    OffsetNumber    i, j, maxoff = entryvec->n - 1, seed_l = FirstOffsetNumber, seed_r = FirstOffsetNumber + 1;
+    BoardSig        *left, *right, *sig;
+    int             d, worst = -1, grow_l, grow_r;
+
+    v->spl_left = (OffsetNumber *) palloc(sizeof(OffsetNumber) * entryvec->n);
+    v->spl_right = (OffsetNumber *) palloc(sizeof(OffsetNumber) * entryvec->n);
+    v->spl_nleft = v->spl_nright = 0;
+
+    for (i=FirstOffsetNumber; i<maxoff; i=OffsetNumberNext(i)) {
+        for (j=OffsetNumberNext(i); j<=maxoff; j=OffsetNumberNext(j)) {
+            d = _boardsig_hamming((BoardSig *) DatumGetPointer(entryvec->vector[i].key),
+                                  (BoardSig *) DatumGetPointer(entryvec->vector[j].key));
+            if (d > worst) {
+                worst = d;
+                seed_l = i;
+                seed_r = j;
+            }
+        }
+    }
+
+    left = _boardsig_new();
+    right = _boardsig_new();
+    _boardsig_union(left, (BoardSig *) DatumGetPointer(entryvec->vector[seed_l].key));
+    _boardsig_union(right, (BoardSig *) DatumGetPointer(entryvec->vector[seed_r].key));
+
+    for (i=FirstOffsetNumber; i<=maxoff; i=OffsetNumberNext(i)) {
+        sig = (BoardSig *) DatumGetPointer(entryvec->vector[i].key);
+        if (i == seed_l) {
+            v->spl_left[v->spl_nleft++] = i;
+            continue;
+        }
+        if (i == seed_r) {
+            v->spl_right[v->spl_nright++] = i;
+            continue;
+        }
+        grow_l = _boardsig_missing(left, sig);
+        grow_r = _boardsig_missing(right, sig);
+        if (grow_l < grow_r || (grow_l == grow_r && v->spl_nleft <= v->spl_nright)) {
+            _boardsig_union(left, sig);
+            v->spl_left[v->spl_nleft++] = i;
+        } else {
+            _boardsig_union(right, sig);
+            v->spl_right[v->spl_nright++] = i;
+        }
+    }
+
+    v->spl_ldatum = PointerGetDatum(left);
+    v->spl_rdatum = PointerGetDatum(right);
+    PG_RETURN_POINTER(v);
+}
+
+CH_STAT_FUNCTION(STAT_GIST, board_gist_same)
+static Datum
+_board_gist_same(PG_FUNCTION_ARGS)
+{
+    const BoardSig  *a = PG_GETARG_BOARDSIG(0);
+    const BoardSig  *b = PG_GETARG_BOARDSIG(1);
+    bool            *result = (bool *) PG_GETARG_POINTER(2);
+
+    *result = a->flags == b->flags && memcmp(a->masks, b->masks, sizeof(a->masks)) == 0;
+    PG_RETURN_POINTER(result);
+}
+
+/* number of occupancy bits per piece type that differ, plus the state */
+Datum
+board_distance(PG_FUNCTION_ARGS)
+{
+    const Board     *a = PG_GETARG_BOARD(0);
+    const Board     *b = PG_GETARG_BOARD(1);
+    BoardSig        sa, sb;
+
+    _boardsig_set(&sa, a);
+    _boardsig_set(&sb, b);
+    PG_RETURN_FLOAT8(_boardsig_distance(&sa, &sb));
+}
+
+CH_STAT_FUNCTION(STAT_GIST, board_gist_distance)
+static Datum
+_board_gist_distance(PG_FUNCTION_ARGS)
+{
+    GISTENTRY       *entry = (GISTENTRY *) PG_GETARG_POINTER(0);
+    const Board     *query = PG_GETARG_BOARD(1);
+    StrategyNumber  strategy = (StrategyNumber) PG_GETARG_UINT16(2);
+    bool            *recheck = (bool *) PG_GETARG_POINTER(4);
+    const BoardSig  *key = (BoardSig *) DatumGetPointer(entry->key);
+
+    *recheck = false;
+    if (strategy != RTKNNSearchStrategyNumber)
+        CH_ERROR("board_gist_distance: unknown strategy number: %d", strategy);
+    PG_RETURN_FLOAT8(_boardsig_distance(key, _boardsig_query(fcinfo, query)));
+}
+/*}}}*/
+/********************************************************
+ * 		board brin: block range summaries
+ ********************************************************/
+/*{{{*/
+
+/*
+ * A range keeps the OR of the occupancy of each side, the least and most
+ * pieces on a board and a 64 bit bloom filter of the material, all int8
+ * so a summary is 40 bytes whatever the range size.
+ */
+enum {BRIN_WHITE, BRIN_BLACK, BRIN_PCOUNT_MIN, BRIN_PCOUNT_MAX, BRIN_MATERIAL, BRIN_NSTORED};
+
+// strategies of brin_board_ops
+#define BRIN_CONTAINS_STRATEGY 1        // @> piecesquare[]
+#define BRIN_OVERLAP_STRATEGY 2         // && piecesquare[]
+#define BRIN_CONTAINS_BOARD_STRATEGY 3  // @> board
+#define BRIN_PCOUNT_LE_STRATEGY 4       // #<= int
+#define BRIN_PCOUNT_GE_STRATEGY 5       // #>= int
+#define BRIN_MATERIAL_STRATEGY 6        // = material
+
+/* two bits of the bloom filter */
+static uint64 _material_bloom(uint64 m)
+{
+    uint64          h = m * 0x9e3779b97f4a7c15ull;
+
+    return (1ull << (h >> 58)) | (1ull << ((h >> 52) & 63));
+}
+
+static void _board_occupancy(const Board *b, uint64 *white, uint64 *black)
+{
+    uint64              bb = b->board;
+    int                 i, k = 0;
+
+    *white = *black = 0;
+    while (bb) {
+        i = pg_leftmost_one_pos64(bb);
+        bb &= ~(1ull << i);
+        if (GET_PIECE(b->pieces, k) < BLACK_PAWN)
+            *white |= 1ull << TO_SQUARE_IDX(i);
+        else
+            *black |= 1ull << TO_SQUARE_IDX(i);
+        k++;
+    }
+}
+
+Datum
+board_pcount_le(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(PG_GETARG_BOARD(0)->pcount <= PG_GETARG_INT32(1));
+}
+
+Datum
+board_pcount_ge(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(PG_GETARG_BOARD(0)->pcount >= PG_GETARG_INT32(1));
+}
+
+Datum
+board_material_eq(PG_FUNCTION_ARGS)
+{
+    PG_RETURN_BOOL(_board_datum_material(PG_GETARG_DATUM(0)) == (uint64) PG_GETARG_INT64(1));
+}
+
+Datum
+board_brin_opcinfo(PG_FUNCTION_ARGS)
+{
+    BrinOpcInfo     *result = palloc0(SizeofBrinOpcInfo(BRIN_NSTORED));
+    int             i;
+
+    result->oi_nstored = BRIN_NSTORED;
+    result->oi_regular_nulls = true;
+    for (i=0; i<BRIN_NSTORED; i++)
+        result->oi_typcache[i] = lookup_type_cache(INT8OID, 0);
+    PG_RETURN_POINTER(result);
+}
+
+/* ors mask into a stored int8 mask; true when that added bits */
+static bool _brin_mask_add(Datum *stored, uint64 mask)
+{
+    uint64          old = (uint64) DatumGetInt64(*stored);
+
+    if ((old | mask) == old)
+        return false;
+    *stored = Int64GetDatum((int64) (old | mask));
+    return true;
+}
+
+CH_STAT_FUNCTION(STAT_BRIN, board_brin_add_value)
+static Datum
+_board_brin_add_value(PG_FUNCTION_ARGS)
+{
+    BrinValues      *column = (BrinValues *) PG_GETARG_POINTER(1);
+    const Board     *b = _board_get(PG_GETARG_DATUM(2));
+    Datum           *v = column->bv_values;
+    uint64          white, black, bloom;
+    bool            updated = false;
+
+    Assert(!PG_GETARG_BOOL(3));
+    _board_occupancy(b, &white, &black);
+    bloom = _material_bloom(_board_material(b));
+    if (column->bv_allnulls) {
+        v[BRIN_WHITE] = Int64GetDatum(white);
+        v[BRIN_BLACK] = Int64GetDatum(black);
+        v[BRIN_PCOUNT_MIN] = v[BRIN_PCOUNT_MAX] = Int64GetDatum(b->pcount);
+        v[BRIN_MATERIAL] = Int64GetDatum(bloom);
+        column->bv_allnulls = false;
+        PG_RETURN_BOOL(true);
+    }
+    updated |= _brin_mask_add(&v[BRIN_WHITE], white);
+    updated |= _brin_mask_add(&v[BRIN_BLACK], black);
+    if (b->pcount < DatumGetInt64(v[BRIN_PCOUNT_MIN])) {
+        v[BRIN_PCOUNT_MIN] = Int64GetDatum(b->pcount);
+        updated = true;
+    }
+    if (b->pcount > DatumGetInt64(v[BRIN_PCOUNT_MAX])) {
+        v[BRIN_PCOUNT_MAX] = Int64GetDatum(b->pcount);
+        updated = true;
+    }
+    updated |= _brin_mask_add(&v[BRIN_MATERIAL], bloom);
+    PG_RETURN_BOOL(updated);
+}
+
+/* false when no board of the range can match the scan key */
+CH_STAT_FUNCTION(STAT_BRIN, board_brin_consistent)
+static Datum
+_board_brin_consistent(PG_FUNCTION_ARGS)
+{
+    BrinValues      *column = (BrinValues *) PG_GETARG_POINTER(1);
+    ScanKey         key = (ScanKey) PG_GETARG_POINTER(2);
+    const Datum     *v = column->bv_values;
+    uint64          occupied[2], bit, white, black, bloom;
+    const Board     *query;
+    int16           *ps;
+    int             i, n;
+
+    occupied[WHITE] = DatumGetInt64(v[BRIN_WHITE]);
+    occupied[BLACK] = DatumGetInt64(v[BRIN_BLACK]);
+    switch (key->sk_strategy) {
+        case BRIN_CONTAINS_STRATEGY:
+        case BRIN_OVERLAP_STRATEGY:
+            ps = _piecesquare_array(DatumGetArrayTypeP(key->sk_argument), &n);
+            for (i=0; i<n; i++) {
+                bit = 1ull << GET_PS_SQUARE(ps[i]);
+                if (!(occupied[GET_PS_PIECE(ps[i]) < BLACK_PAWN ? WHITE : BLACK] & bit)) {
+                    if (key->sk_strategy == BRIN_CONTAINS_STRATEGY)
+                        PG_RETURN_BOOL(false);
+                } else if (key->sk_strategy == BRIN_OVERLAP_STRATEGY)
+                    PG_RETURN_BOOL(true);
+            }
+            PG_RETURN_BOOL(key->sk_strategy == BRIN_CONTAINS_STRATEGY);
+        case BRIN_CONTAINS_BOARD_STRATEGY:
+            query = _board_get(key->sk_argument);
+            _board_occupancy(query, &white, &black);
+            PG_RETURN_BOOL((occupied[WHITE] & white) == white && (occupied[BLACK] & black) == black
+                    && query->pcount <= DatumGetInt64(v[BRIN_PCOUNT_MAX]));
+        case BRIN_PCOUNT_LE_STRATEGY:
+            PG_RETURN_BOOL(DatumGetInt64(v[BRIN_PCOUNT_MIN]) <= DatumGetInt32(key->sk_argument));
+        case BRIN_PCOUNT_GE_STRATEGY:
+            PG_RETURN_BOOL(DatumGetInt64(v[BRIN_PCOUNT_MAX]) >= DatumGetInt32(key->sk_argument));
+        case BRIN_MATERIAL_STRATEGY:
+            bloom = _material_bloom(DatumGetInt64(key->sk_argument));
+            PG_RETURN_BOOL((DatumGetInt64(v[BRIN_MATERIAL]) & bloom) == bloom);
+        default:
+            CH_ERROR("board_brin_consistent: unknown strategy number: %d", key->sk_strategy);
+    }
+    PG_RETURN_BOOL(true);
+}
+
+CH_STAT_FUNCTION(STAT_BRIN, board_brin_union)
+static Datum
+_board_brin_union(PG_FUNCTION_ARGS)
+{
+    BrinValues      *a = (BrinValues *) PG_GETARG_POINTER(1);
+    BrinValues      *b = (BrinValues *) PG_GETARG_POINTER(2);
+    Datum           *va = a->bv_values;
+    const Datum     *vb = b->bv_values;
+
+    Assert(!a->bv_allnulls && !b->bv_allnulls);
+    va[BRIN_WHITE] = Int64GetDatum(DatumGetInt64(va[BRIN_WHITE]) | DatumGetInt64(vb[BRIN_WHITE]));
+    va[BRIN_BLACK] = Int64GetDatum(DatumGetInt64(va[BRIN_BLACK]) | DatumGetInt64(vb[BRIN_BLACK]));
+    va[BRIN_PCOUNT_MIN] = Int64GetDatum(Min(DatumGetInt64(va[BRIN_PCOUNT_MIN]), DatumGetInt64(vb[BRIN_PCOUNT_MIN])));
+    va[BRIN_PCOUNT_MAX] = Int64GetDatum(Max(DatumGetInt64(va[BRIN_PCOUNT_MAX]), DatumGetInt64(vb[BRIN_PCOUNT_MAX])));
+    va[BRIN_MATERIAL] = Int64GetDatum(DatumGetInt64(va[BRIN_MATERIAL]) | DatumGetInt64(vb[BRIN_MATERIAL]));
+    PG_RETURN_VOID();
+}
+/*}}}*/
+/********************************************************
+ * 		board statistics
+ ********************************************************/
+/*{{{*/
+
+/*
+ * board_typanalyze adds two slots to the standard mcv, histogram and
+ * correlation of a board column, counted over the whole analyze sample:
+ *
+ * STATISTIC_KIND_BOARD: stanumbers has the fraction of non null boards with
+ * each piece on each square, then of each pcount 0..PIECES_MAX, then of
+ * white to move, laid out as BOARD_STATS_*.
+ *
+ * STATISTIC_KIND_BOARD_MATERIAL: stavalues are the most common material,
+ * stanumbers their fractions of the non null boards followed by the number
+ * of distinct material in the sample.
+ *
+ * The kinds are in the range pg_statistic.h leaves for private use.
+ */
+#define STATISTIC_KIND_BOARD            12100
+#define STATISTIC_KIND_BOARD_MATERIAL   12101
+
+#define BOARD_STATS_PSQ         0       // piece * SQUARE_MAX + square
+#define BOARD_STATS_PCOUNT      (BOARD_STATS_PSQ + CPIECE_MAX * SQUARE_MAX)
+#define BOARD_STATS_WHITE       (BOARD_STATS_PCOUNT + PIECES_MAX + 1)
+#define BOARD_STATS_N           (BOARD_STATS_WHITE + 1)
+
+typedef struct {
+    AnalyzeAttrComputeStatsFunc std_compute_stats;
+    void                        *std_extra_data;
+    Oid                         material_type;
+} BoardAnalyzeExtra;
+
+typedef struct {
+    uint64          material;
+    int             count;
+} MaterialCount;
+
+static int _uint64_cmp(const void *a, const void *b)
+{
+    uint64          x = *(const uint64 *) a, y = *(const uint64 *) b;
+
+    return x < y ? -1 : x > y;
+}
+
+/* most common first */
+static int _material_count_cmp(const void *a, const void *b)
+{
+    return ((const MaterialCount *) b)->count - ((const MaterialCount *) a)->count;
+}
+
+static void _board_compute_stats(VacAttrStats *stats, AnalyzeAttrFetchFunc fetchfunc,
+        int samplerows, double totalrows)
+{
+    BoardAnalyzeExtra *extra = (BoardAnalyzeExtra *) stats->extra_data;
+    MemoryContext   oldcontext;
+    const Board     *b;
+    Datum           value;
+    bool            isnull;
+    uint64          bb, *materials;
+    MaterialCount   *common;
+    float4          *numbers;
+    Datum           *values;
+    int64           psq[CPIECE_MAX * SQUARE_MAX];
+    int64           pcount[PIECES_MAX + 1];
+    int64           white = 0;
+    int             i, j, k, n = 0, ndistinct = 0, ncommon, slot, target;
+
+    stats->extra_data = extra->std_extra_data;
+    extra->std_compute_stats(stats, fetchfunc, samplerows, totalrows);
+    stats->extra_data = extra;
+
+    memset(psq, 0, sizeof(psq));
+    memset(pcount, 0, sizeof(pcount));
+    materials = (uint64 *) palloc(sizeof(uint64) * samplerows);
+    for (i=0; i<samplerows; i++) {
+#if PG_VERSION_NUM >= 180000
+        vacuum_delay_point(true);
+#else
+        vacuum_delay_point();
+#endif
+        value = fetchfunc(stats, i, &isnull);
+        if (isnull)
+            continue;
+        b = _board_get(value);
+        bb = b->board;
+        k = 0;
+        while (bb) {
+            j = pg_leftmost_one_pos64(bb);
+            bb &= ~(1ull << j);
+            psq[GET_PIECE(b->pieces, k) * SQUARE_MAX + TO_SQUARE_IDX(j)]++;
+            k++;
+        }
+        pcount[k]++;
+        white += b->whitesgo;
+        materials[n++] = _board_material(b);
+        if ((Pointer) b != DatumGetPointer(value))
+            pfree((void *) b);
+    }
+    if (n == 0)
+        return;
+
+    // after the standard slots
+    for (slot=0; slot<STATISTIC_NUM_SLOTS && stats->stakind[slot] != 0; slot++)
+        ;
+    if (slot == STATISTIC_NUM_SLOTS)
+        return;
+
+    oldcontext = MemoryContextSwitchTo(stats->anl_context);
+    numbers = (float4 *) palloc(sizeof(float4) * BOARD_STATS_N);
+    for (i=0; i<CPIECE_MAX * SQUARE_MAX; i++)
+        numbers[BOARD_STATS_PSQ + i] = (double) psq[i] / n;
+    for (i=0; i<=PIECES_MAX; i++)
+        numbers[BOARD_STATS_PCOUNT + i] = (double) pcount[i] / n;
+    numbers[BOARD_STATS_WHITE] = (double) white / n;
+    MemoryContextSwitchTo(oldcontext);
+    stats->stakind[slot] = STATISTIC_KIND_BOARD;
+    stats->staop[slot] = InvalidOid;
+    stats->stacoll[slot] = InvalidOid;
+    stats->stanumbers[slot] = numbers;
+    stats->numnumbers[slot] = BOARD_STATS_N;
+    slot++;
+
+    if (slot == STATISTIC_NUM_SLOTS)
+        return;
+
+    // count runs of the sorted material, then keep those seen more than once
+    qsort(materials, n, sizeof(uint64), _uint64_cmp);
+    common = (MaterialCount *) palloc(sizeof(MaterialCount) * n);
+    for (i=0; i<n; i++) {
+        if (i == 0 || materials[i] != materials[i - 1]) {
+            common[ndistinct].material = materials[i];
+            common[ndistinct++].count = 0;
+        }
+        common[ndistinct - 1].count++;
+    }
+    qsort(common, ndistinct, sizeof(MaterialCount), _material_count_cmp);
+#if PG_VERSION_NUM >= 170000
+    target = stats->attstattarget;
+#else
+    target = stats->attr->attstattarget;
+#endif
+    ncommon = Min(ndistinct, target);
+    if (ndistinct > target)
+        while (ncommon > 0 && common[ncommon - 1].count < 2)
+            ncommon--;
+
+    oldcontext = MemoryContextSwitchTo(stats->anl_context);
+    values = (Datum *) palloc(sizeof(Datum) * Max(ncommon, 1));
+    numbers = (float4 *) palloc(sizeof(float4) * (ncommon + 1));
+    for (i=0; i<ncommon; i++) {
+        values[i] = Int64GetDatum(common[i].material);
+        numbers[i] = (double) common[i].count / n;
+    }
+    numbers[ncommon] = ndistinct;
+    MemoryContextSwitchTo(oldcontext);
+    stats->stakind[slot] = STATISTIC_KIND_BOARD_MATERIAL;
+    stats->staop[slot] = InvalidOid;
+    stats->stacoll[slot] = InvalidOid;
+    stats->stavalues[slot] = values;
+    stats->numvalues[slot] = ncommon;
+    stats->stanumbers[slot] = numbers;
+    stats->numnumbers[slot] = ncommon + 1;
+    stats->statypid[slot] = extra->material_type;
+    stats->statyplen[slot] = sizeof(int64);
+    stats->statypbyval[slot] = FLOAT8PASSBYVAL;
+    stats->statypalign[slot] = TYPALIGN_DOUBLE;
+}
+
+Datum
+board_typanalyze(PG_FUNCTION_ARGS)
+{
+    VacAttrStats    *stats = (VacAttrStats *) PG_GETARG_POINTER(0);
+    BoardAnalyzeExtra *extra;
+
+    if (!std_typanalyze(stats))
+        PG_RETURN_BOOL(false);
+    extra = (BoardAnalyzeExtra *) palloc(sizeof(BoardAnalyzeExtra));
+    extra->std_compute_stats = stats->compute_stats;
+    extra->std_extra_data = stats->extra_data;
+    extra->material_type = _chess_index_type(fcinfo, "material");
+    stats->compute_stats = _board_compute_stats;
+    stats->extra_data = extra;
+    PG_RETURN_BOOL(true);
+}
+/*}}}*/
+/********************************************************
+ * 		board selectivity
+ ********************************************************/
+/*{{{*/
+
+/*
+ * The planner estimates for the board operators. The column's mcv and
+ * histogram boards are a weighted sample of the table: each mcv stands for
+ * its frequency and each histogram board for an equal share of the rest, so
+ * running the operator over them gives the fraction of rows it keeps. When
+ * no sampled board matches a containment, the piece square frequencies of
+ * the sample are multiplied as if independent. A column analyzed with
+ * board_typanalyze has those frequencies, pcount and material from the
+ * whole analyze sample instead.
+ */
+#define CH_PSQ_SEL          0.1     // chance of a given piece on a given square, without stats
+#define CH_CONTAINED_SEL    0.005
+#define CH_JOINSEL_SAMPLE   100     // boards per side compared for a join
+
+typedef enum {
+    BSEL_CONTAINS,                  // board @> const
+    BSEL_CONTAINED,                 // board <@ const
+    BSEL_OVERLAPS,                  // board && const
+    BSEL_EQ,                        // board = material
+    BSEL_LE,                        // board #<= int
+    BSEL_GE                         // board #>= int
+} board_sel;
+
+typedef struct {
+    int             n;
+    Datum           *values;        // mcv then histogram
+    double          *weights;       // fraction of all rows
+    double          nullfrac;
+    double          histweight;     // weight of one histogram value, 0 without one
+    AttStatsSlot    mcv;
+    AttStatsSlot    hist;
+} BoardSample;
+
+static bool _board_sample(VariableStatData *vardata, BoardSample *s)
+{
+    double          rest;
+    int             i;
+
+    memset(s, 0, sizeof(BoardSample));
+    if (!HeapTupleIsValid(vardata->statsTuple))
+        return false;
+    s->nullfrac = ((Form_pg_statistic) GETSTRUCT(vardata->statsTuple))->stanullfrac;
+    get_attstatsslot(&s->mcv, vardata->statsTuple, STATISTIC_KIND_MCV, InvalidOid,
+            ATTSTATSSLOT_VALUES | ATTSTATSSLOT_NUMBERS);
+    get_attstatsslot(&s->hist, vardata->statsTuple, STATISTIC_KIND_HISTOGRAM, InvalidOid,
+            ATTSTATSSLOT_VALUES);
+    if (s->mcv.nvalues + s->hist.nvalues == 0) {
+        free_attstatsslot(&s->mcv);
+        free_attstatsslot(&s->hist);
+        return false;
+    }
+
+    s->values = (Datum *) palloc(sizeof(Datum) * (s->mcv.nvalues + s->hist.nvalues));
+    s->weights = (double *) palloc(sizeof(double) * (s->mcv.nvalues + s->hist.nvalues));
+    rest = 1.0 - s->nullfrac;
+    for (i=0; i<s->mcv.nvalues; i++) {
+        s->values[s->n] = s->mcv.values[i];
+        s->weights[s->n++] = s->mcv.numbers[i];
+        rest -= s->mcv.numbers[i];
+    }
+    if (s->hist.nvalues > 0) {
+        s->histweight = Max(rest, 0.0) / s->hist.nvalues;
+        for (i=0; i<s->hist.nvalues; i++) {
+            s->values[s->n] = s->hist.values[i];
+            s->weights[s->n++] = s->histweight;
+        }
+    }
+    return true;
+}
+
+static void _board_sample_free(BoardSample *s)
+{
+    pfree(s->values);
+    pfree(s->weights);
+    free_attstatsslot(&s->mcv);
+    free_attstatsslot(&s->hist);
+}
+
+/* keeps at most max values, each standing for the weights of those it replaces */
+static void _board_sample_thin(BoardSample *s, int max)
+{
+    int             step = (s->n + max - 1) / max;
+    int             i, j, n = 0;
+    double          w;
+
+    if (step <= 1)
+        return;
+    for (i=0; i<s->n; i+=step) {
+        w = 0;
+        for (j=i; j<Min(i + step, s->n); j++)
+            w += s->weights[j];
+        s->values[n] = s->values[i];
+        s->weights[n++] = w;
+    }
+    s->n = n;
+}
+
+/* fraction of piece square frequencies over the boards of the sample */
+static void _board_sample_psq(const BoardSample *s, double psq[CPIECE_MAX][SQUARE_MAX])
+{
+    const Board     *b;
+    uint64          bb;
+    double          total = 0;
+    int             i, j, k;
+
+    memset(psq, 0, sizeof(double) * CPIECE_MAX * SQUARE_MAX);
+    for (i=0; i<s->n; i++) {
+        b = _board_get(s->values[i]);
+        bb = b->board;
+        k = 0;
+        while (bb) {
+            j = pg_leftmost_one_pos64(bb);
+            bb &= ~(1ull << j);
+            psq[GET_PIECE(b->pieces, k)][TO_SQUARE_IDX(j)] += s->weights[i];
+            k++;
+        }
+        total += s->weights[i];
+    }
+    if (total > 0)
+        for (i=0; i<CPIECE_MAX; i++)
+            for (j=0; j<SQUARE_MAX; j++)
+                psq[i][j] /= total;
+}
+
+/*
+ * Boards with all (or for overlaps any) of the piece squares, the squares
+ * taken as independent. Without frequencies every one is CH_PSQ_SEL; a
+ * piece square the sample never had counts as floor.
+ */
+static double _board_psq_sel(double psq[CPIECE_MAX][SQUARE_MAX], const int16 *ps, int n,
+        bool overlaps, double floor)
+{
+    double          sel = 1.0, f;
+    int             i;
+
+    for (i=0; i<n; i++) {
+        f = psq ? Max(psq[GET_PS_PIECE(ps[i])][GET_PS_SQUARE(ps[i])], floor) : CH_PSQ_SEL;
+        sel *= overlaps ? 1.0 - f : f;
+    }
+    return overlaps ? 1.0 - sel : sel;
+}
+
+/* the analyzed piece square frequencies, false without them */
+static bool _board_analyzed_psq(VariableStatData *vardata, double psq[CPIECE_MAX][SQUARE_MAX])
+{
+    AttStatsSlot    slot;
+    int             i;
+
+    if (!get_attstatsslot(&slot, vardata->statsTuple, STATISTIC_KIND_BOARD, InvalidOid, ATTSTATSSLOT_NUMBERS))
+        return false;
+    if (slot.nnumbers != BOARD_STATS_N) {
+        free_attstatsslot(&slot);
+        return false;
+    }
+    for (i=0; i<CPIECE_MAX * SQUARE_MAX; i++)
+        psq[i / SQUARE_MAX][i % SQUARE_MAX] = slot.numbers[BOARD_STATS_PSQ + i];
+    free_attstatsslot(&slot);
+    return true;
+}
+
+/* #<= and #>= from the pcount fractions, = material like var_eq_const; -1 without them */
+static double _board_analyzed_sel(VariableStatData *vardata, board_sel kind, Datum constval)
+{
+    AttStatsSlot    slot;
+    double          nonnull = 1.0 - ((Form_pg_statistic) GETSTRUCT(vardata->statsTuple))->stanullfrac;
+    double          sel = -1, rest = 1.0, others;
+    int             i, n;
+
+    if (kind == BSEL_LE || kind == BSEL_GE) {
+        if (!get_attstatsslot(&slot, vardata->statsTuple, STATISTIC_KIND_BOARD, InvalidOid, ATTSTATSSLOT_NUMBERS))
+            return -1;
+        if (slot.nnumbers == BOARD_STATS_N) {
+            n = DatumGetInt32(constval);
+            sel = 0;
+            for (i=0; i<=PIECES_MAX; i++)
+                if (kind == BSEL_LE ? i <= n : i >= n)
+                    sel += slot.numbers[BOARD_STATS_PCOUNT + i];
+            sel *= nonnull;
+        }
+        free_attstatsslot(&slot);
+    } else if (kind == BSEL_EQ) {
+        if (!get_attstatsslot(&slot, vardata->statsTuple, STATISTIC_KIND_BOARD_MATERIAL, InvalidOid,
+                    ATTSTATSSLOT_VALUES | ATTSTATSSLOT_NUMBERS))
+            return -1;
+        for (i=0; i<slot.nvalues; i++) {
+            if (DatumGetInt64(slot.values[i]) == DatumGetInt64(constval)) {
+                sel = slot.numbers[i];
+                break;
+            }
+            rest -= slot.numbers[i];
+        }
+        // not common: an even share of the rest, no more than the least common
+        if (sel < 0 && slot.nnumbers == slot.nvalues + 1) {
+            others = slot.numbers[slot.nvalues] - slot.nvalues;
+            sel = others >= 1 ? Max(rest, 0.0) / others : 0;
+            if (slot.nvalues > 0)
+                sel = Min(sel, slot.numbers[slot.nvalues - 1]);
+        }
+        if (sel >= 0)
+            sel *= nonnull;
+        free_attstatsslot(&slot);
+    }
+    return sel;
+}
+
+static double _board_default_sel(board_sel kind)
+{
+    switch (kind) {
+        case BSEL_CONTAINED:
+            return CH_CONTAINED_SEL;
+        case BSEL_LE:
+        case BSEL_GE:
+            return DEFAULT_INEQ_SEL;
+        case BSEL_EQ:
+        default:
+            return DEFAULT_EQ_SEL;
+    }
+}
+
+static double _board_restrictsel(PlannerInfo *root, Oid operator, List *args, int varRelid,
+        Oid collation, board_sel kind)
+{
+    VariableStatData vardata;
+    Node            *other;
+    bool            varonleft;
+    Datum           constval;
+    Oid             lefttype, righttype;
+    BoardSample     sample;
+    FmgrInfo        proc;
+    ArrayType       *a;
+    int16           ps[PIECES_MAX], *pps = ps;
+    int             nps = -1;
+    double          psq[CPIECE_MAX][SQUARE_MAX];
+    double          sel;
+    int             i;
+
+    if (!get_restriction_variable(root, args, varRelid, &vardata, &other, &varonleft))
+        return _board_default_sel(kind);
+    if (!IsA(other, Const)) {
+        ReleaseVariableStats(vardata);
+        return _board_default_sel(kind);
+    }
+    if (((Const *) other)->constisnull) {
+        ReleaseVariableStats(vardata);
+        return 0.0;
+    }
+    constval = ((Const *) other)->constvalue;
+
+    // const @> board is board <@ const; the board operators all take a board on the left
+    op_input_types(operator, &lefttype, &righttype);
+    if (!varonleft && righttype == lefttype) {
+        if (kind == BSEL_CONTAINS)
+            kind = BSEL_CONTAINED;
+        else if (kind == BSEL_CONTAINED)
+            kind = BSEL_CONTAINS;
+    }
+
+    // the piece squares a board column needs for the constant
+    if ((varonleft || righttype == lefttype) && (kind == BSEL_CONTAINS || kind == BSEL_OVERLAPS)) {
+        if (righttype == lefttype)
+            nps = _board_piecesquares(_board_get(constval), ps);
+        else {
+            a = DatumGetArrayTypeP(constval);
+            if (ARR_NDIM(a) <= 1 && !array_contains_nulls(a)) {
+                nps = ArrayGetNItems(ARR_NDIM(a), ARR_DIMS(a));
+                pps = (int16 *) ARR_DATA_PTR(a);
+            }
+        }
+    }
+
+    if (varonleft && HeapTupleIsValid(vardata.statsTuple)
+            && (sel = _board_analyzed_sel(&vardata, kind, constval)) >= 0) {
+        ReleaseVariableStats(vardata);
+        CLAMP_PROBABILITY(sel);
+        return sel;
+    }
+
+    if (_board_sample(&vardata, &sample)) {
+        fmgr_info(get_opcode(operator), &proc);
+        sel = 0;
+        for (i=0; i<sample.n; i++)
+            if (DatumGetBool(varonleft
+                        ? FunctionCall2Coll(&proc, collation, sample.values[i], constval)
+                        : FunctionCall2Coll(&proc, collation, constval, sample.values[i])))
+                sel += sample.weights[i];
+        // matched nothing: less than one histogram board's worth
+        if (sel == 0 && nps >= 0) {
+            if (!_board_analyzed_psq(&vardata, psq))
+                _board_sample_psq(&sample, psq);
+            sel = (1.0 - sample.nullfrac)
+                * _board_psq_sel(psq, pps, nps, kind == BSEL_OVERLAPS, 0.5 / sample.n);
+            sel = Min(sel, sample.histweight);
+        } else if (sel == 0)
+            sel = sample.histweight / 2;
+        _board_sample_free(&sample);
+    } else if (nps >= 0) {
+        sel = HeapTupleIsValid(vardata.statsTuple) && _board_analyzed_psq(&vardata, psq)
+            ? _board_psq_sel(psq, pps, nps, kind == BSEL_OVERLAPS, 0)
+            : _board_psq_sel(NULL, pps, nps, kind == BSEL_OVERLAPS, 0);
+    }
+    else
+        sel = _board_default_sel(kind);
+
+    ReleaseVariableStats(vardata);
+    CLAMP_PROBABILITY(sel);
+    return sel;
+}
+
+#define BOARD_RESTRICTSEL(kind) \
+    PG_RETURN_FLOAT8(_board_restrictsel((PlannerInfo *) PG_GETARG_POINTER(0), PG_GETARG_OID(1), \
+                (List *) PG_GETARG_POINTER(2), PG_GETARG_INT32(3), PG_GET_COLLATION(), kind))
+
+/* board @> piecesquare[] and board @> board */
+Datum
+board_contsel(PG_FUNCTION_ARGS)
+{
+    BOARD_RESTRICTSEL(BSEL_CONTAINS);
+}
+
+/* board <@ board */
+Datum
+board_containedsel(PG_FUNCTION_ARGS)
+{
+    BOARD_RESTRICTSEL(BSEL_CONTAINED);
+}
+
+/* board && piecesquare[] */
+Datum
+board_overlapsel(PG_FUNCTION_ARGS)
+{
+    BOARD_RESTRICTSEL(BSEL_OVERLAPS);
+}
+
+/* board = material */
+Datum
+board_eqsel(PG_FUNCTION_ARGS)
+{
+    BOARD_RESTRICTSEL(BSEL_EQ);
+}
+
+/* board #<= int */
+Datum
+board_lesel(PG_FUNCTION_ARGS)
+{
+    BOARD_RESTRICTSEL(BSEL_LE);
+}
+
+/* board #>= int */
+Datum
+board_gesel(PG_FUNCTION_ARGS)
+{
+    BOARD_RESTRICTSEL(BSEL_GE);
+}
+
+/*
+ * Joins run the operator over the samples of both sides, at most
+ * CH_JOINSEL_SAMPLE values each. For semi and anti joins the fraction is of
+ * outer rows with any match, so the outer side is the one the loop walks;
+ * the operator still gets its arguments in their own order.
+ */
+Datum
+board_joinsel(PG_FUNCTION_ARGS)
+{
+    PlannerInfo     *root = (PlannerInfo *) PG_GETARG_POINTER(0);
+    Oid             operator = PG_GETARG_OID(1);
+    List            *args = (List *) PG_GETARG_POINTER(2);
+    JoinType        jointype = (JoinType) PG_GETARG_INT16(3);
+    SpecialJoinInfo *sjinfo = (SpecialJoinInfo *) PG_GETARG_POINTER(4);
+    VariableStatData vardata1, vardata2;
+    bool            join_is_reversed;
+    BoardSample     s1, s2, *outer, *inner;
+    FmgrInfo        proc;
+    double          sel = DEFAULT_EQ_SEL, matched;
+    Datum           left, right;
+    int             i, j;
+
+    get_join_variables(root, args, sjinfo, &vardata1, &vardata2, &join_is_reversed);
+    if (_board_sample(&vardata1, &s1)) {
+        if (_board_sample(&vardata2, &s2)) {
+            _board_sample_thin(&s1, CH_JOINSEL_SAMPLE);
+            _board_sample_thin(&s2, CH_JOINSEL_SAMPLE);
+            fmgr_info(get_opcode(operator), &proc);
+            outer = join_is_reversed ? &s2 : &s1;
+            inner = join_is_reversed ? &s1 : &s2;
+            sel = 0;
+            for (i=0; i<outer->n; i++) {
+                matched = 0;
+                for (j=0; j<inner->n; j++) {
+                    left = join_is_reversed ? inner->values[j] : outer->values[i];
+                    right = join_is_reversed ? outer->values[i] : inner->values[j];
+                    if (!DatumGetBool(FunctionCall2Coll(&proc, PG_GET_COLLATION(), left, right)))
+                        continue;
+                    if (jointype == JOIN_SEMI || jointype == JOIN_ANTI) {
+                        matched = 1.0;
+                        break;
+                    }
+                    matched += inner->weights[j];
+                }
+                sel += outer->weights[i] * matched;
+            }
+            _board_sample_free(&s2);
+        }
+        _board_sample_free(&s1);
+    }
+    ReleaseVariableStats(vardata1);
+    ReleaseVariableStats(vardata2);
+    CLAMP_PROBABILITY(sel);
+    PG_RETURN_FLOAT8(sel);
+}
+/*}}}*/
+/********************************************************
+ * 		heatmap aggregate
+ ********************************************************/
+/*{{{*/
+
+/* boards seen and how often each piece stood on each square */
+typedef struct {
+    int64                 count;
+    int64                 squares[CPIECE_MAX][SQUARE_MAX];
+} HeatmapState;
+
+static HeatmapState *_heatmap_state(FunctionCallInfo fcinfo, const char *fname)
+{
+    MemoryContext   aggcontext;
+
+    if (!AggCheckCallContext(fcinfo, &aggcontext))
+        CH_ERROR("%s called in non-aggregate context", fname);
+    if (PG_ARGISNULL(0))
+        return (HeatmapState *) MemoryContextAllocZero(aggcontext, sizeof(HeatmapState));
+    return (HeatmapState *) PG_GETARG_POINTER(0);
+}
+
+/* one bit scan over the bitboard, the piece of each square from its nibble */
+static void _heatmap_add(HeatmapState *state, const Board *b, int64 n)
+{
+    uint64              bb = b->board;
+    int                 i, k = 0;
+
+    state->count += n;
+    while (bb) {
+        i = pg_leftmost_one_pos64(bb);
+        bb &= ~(1ull << i);
+        state->squares[GET_PIECE(b->pieces, k)][TO_SQUARE_IDX(i)] += n;
+        k++;
+    }
+}
+
+Datum
+heatmap_transfn(PG_FUNCTION_ARGS)
+{
+    HeatmapState    *state = _heatmap_state(fcinfo, "heatmap_transfn");
+
+    if (!PG_ARGISNULL(1))
+        _heatmap_add(state, PG_GETARG_BOARD(1), 1);
+    PG_RETURN_POINTER(state);
+}
+
+/* moving aggregate inverse: take back a board that left the window frame */
+Datum
+heatmap_invfn(PG_FUNCTION_ARGS)
+{
+    HeatmapState    *state = _heatmap_state(fcinfo, "heatmap_invfn");
+
+    if (!PG_ARGISNULL(1))
+        _heatmap_add(state, PG_GETARG_BOARD(1), -1);
+    PG_RETURN_POINTER(state);
+}
+
+Datum
+heatmap_combine(PG_FUNCTION_ARGS)
+{
+    HeatmapState    *state;
+    const HeatmapState *other;
+    int64           *a;
+    const int64     *b;
+    int             i;
+
+    if (PG_ARGISNULL(1)) {
+        if (PG_ARGISNULL(0))
+            PG_RETURN_NULL();
+        PG_RETURN_DATUM(PG_GETARG_DATUM(0));
+    }
+    state = _heatmap_state(fcinfo, "heatmap_combine");
+    other = (HeatmapState *) PG_GETARG_POINTER(1);
+    a = &state->squares[0][0];
+    b = &other->squares[0][0];
+    state->count += other->count;
+    // a flat loop over the counters, which compilers vectorize
+    for (i=0; i<CPIECE_MAX * SQUARE_MAX; i++)
+        a[i] += b[i];
+    PG_RETURN_POINTER(state);
+}
+
+/* the state as is: parallel workers run the same build */
+Datum
+heatmap_serialize(PG_FUNCTION_ARGS)
+{
+    const HeatmapState *state = (HeatmapState *) PG_GETARG_POINTER(0);
+    bytea           *result = (bytea *) palloc(VARHDRSZ + sizeof(HeatmapState));
+
+    if (!AggCheckCallContext(fcinfo, NULL))
+        CH_ERROR("heatmap_serialize called in non-aggregate context");
+    SET_VARSIZE(result, VARHDRSZ + sizeof(HeatmapState));
+    memcpy(VARDATA(result), state, sizeof(HeatmapState));
+    PG_RETURN_BYTEA_P(result);
+}
+
+Datum
+heatmap_deserialize(PG_FUNCTION_ARGS)
+{
+    bytea           *data = PG_GETARG_BYTEA_PP(0);
+    HeatmapState    *result = (HeatmapState *) palloc(sizeof(HeatmapState));
+
+    if (!AggCheckCallContext(fcinfo, NULL))
+        CH_ERROR("heatmap_deserialize called in non-aggregate context");
+    if (VARSIZE_ANY_EXHDR(data) != sizeof(HeatmapState))
+        CH_ERROR("heatmap_deserialize: bad state size: %d", (int) VARSIZE_ANY_EXHDR(data));
+    memcpy(result, VARDATA_ANY(data), sizeof(HeatmapState));
+    PG_RETURN_POINTER(result);
+}
+
+/*
+ * int8[12][64]: the first index is the piece in cpiece order (PNBRQK then
+ * pnbrqk), the second the square number plus one.
+ */
+Datum
+heatmap_final(PG_FUNCTION_ARGS)
+{
+    const HeatmapState *state;
+    Datum           *elems;
+    int             dims[2] = {CPIECE_MAX, SQUARE_MAX}, lbs[2] = {1, 1};
+    int             i;
+
+    if (PG_ARGISNULL(0))
+        PG_RETURN_NULL();
+    state = (HeatmapState *) PG_GETARG_POINTER(0);
+    if (state->count == 0)
+        PG_RETURN_NULL();
+    elems = (Datum *) palloc(sizeof(Datum) * CPIECE_MAX * SQUARE_MAX);
+    for (i=0; i<CPIECE_MAX * SQUARE_MAX; i++)
+        elems[i] = Int64GetDatum((&state->squares[0][0])[i]);
+    PG_RETURN_ARRAYTYPE_P(construct_md_array(elems, NULL, 2, dims, lbs, INT8OID, sizeof(int64), FLOAT8PASSBYVAL, TYPALIGN_DOUBLE));
+}
+/*}}}*/
+/********************************************************
+ * 		position interning
+ ********************************************************/
+/*{{{*/
+
+/*
+ * position_id(board) maps a board to the id of its row in
+ * chess_index_positions, inserting the row the first time. With the
+ * library in shared_preload_libraries the committed ids are also kept in a
+ * dshash table, so repeated positions are found without touching the
+ * table. Each database has its own table and sequence, and a new CREATE
+ * EXTENSION starts the ids over, so the key is the database, the extension
+ * and the zobrist.
+ *
+ * Ids a transaction looked up or inserted wait in a backend local table.
+ * Their shared entries are made at once with id 0, which readers skip, and
+ * the commit only fills in the ids: nothing is allocated after the commit
+ * record, where an error would be a PANIC. An id in shared memory so always
+ * has a committed row behind it. Abort, PREPARE and a subtransaction abort
+ * (its rows may be gone) drop the local table and the entries still at 0.
+ */
+typedef struct {
+    Oid             dbid;
+    Oid             extoid;
+    uint64          zobrist;
+} InternKey;
+
+typedef struct {
+    InternKey       key;
+    int64           id;             // 0 until the inserting transaction commits
+    char            board[BOARD_SIZE(PIECES_MAX)];
+} InternEntry;
+
+typedef struct {
+    LWLock              *lock;      // creating the table
+    int                 tranche_id;
+    dsa_handle          area;
+    dshash_table_handle table;
+    pg_atomic_uint64    entries;
+} InternShared;
+
+/* what a call site needs, looked up once into fn_extra */
+typedef struct {
+    Oid             extoid;
+    Oid             nsp;            // schema of the extension
+    Oid             board_oid;
+} InternCall;
+
+static int              chess_index_intern_max = 1000000;
+static InternShared     *intern_shared = NULL;
+static dsa_area         *intern_area = NULL;
+static dshash_table     *intern_table = NULL;
+static HTAB             *intern_pending = NULL;
+static SPIPlanPtr       intern_id_plan = NULL;
+static SPIPlanPtr       intern_of_plan = NULL;
+static Oid              intern_plan_extoid = InvalidOid;
+static Oid              intern_plan_nsp = InvalidOid;
+
+static dshash_parameters intern_params = {
+    .key_size = sizeof(InternKey),
+    .entry_size = sizeof(InternEntry),
+    .compare_function = dshash_memcmp,
+    .hash_function = dshash_memhash,
+#if PG_VERSION_NUM >= 170000
+    .copy_function = dshash_memcpy,
+#endif
+    .tranche_id = 0                 // set in _intern_attach
+};
+
+static void _intern_shmem_request(void)
+{
+    RequestAddinShmemSpace(sizeof(InternShared));
+    RequestNamedLWLockTranche("chess_index intern", 1);
+}
+
+/* called holding AddinShmemInitLock */
+static void _intern_shmem_startup(void)
+{
+    bool            found;
+
+    intern_shared = ShmemInitStruct("chess_index intern", sizeof(InternShared), &found);
+    if (!found) {
+        intern_shared->lock = &(GetNamedLWLockTranche("chess_index intern"))->lock;
+        intern_shared->tranche_id = LWLockNewTrancheId();
+        intern_shared->area = DSA_HANDLE_INVALID;
+        intern_shared->table = DSHASH_HANDLE_INVALID;
+        pg_atomic_init_u64(&intern_shared->entries, 0);
+    }
+}
+
+/* the shared table, created by the first backend to use it; false without shared memory */
+static bool _intern_attach(void)
+{
+    MemoryContext   oldcontext;
+
+    if (intern_table != NULL)
+        return true;
+    if (intern_shared == NULL || chess_index_intern_max == 0)
+        return false;
+
+    oldcontext = MemoryContextSwitchTo(TopMemoryContext);
+    LWLockRegisterTranche(intern_shared->tranche_id, "chess_index intern table");
+    intern_params.tranche_id = intern_shared->tranche_id;
+    LWLockAcquire(intern_shared->lock, LW_EXCLUSIVE);
+    if (intern_shared->area == DSA_HANDLE_INVALID) {
+        intern_area = dsa_create(intern_shared->tranche_id);
+        dsa_pin(intern_area);
+        dsa_pin_mapping(intern_area);
+        intern_table = dshash_create(intern_area, &intern_params, NULL);
+        intern_shared->table = dshash_get_hash_table_handle(intern_table);
+        intern_shared->area = dsa_get_handle(intern_area);
+    } else {
+        intern_area = dsa_attach(intern_shared->area);
+        dsa_pin_mapping(intern_area);
+        intern_table = dshash_attach(intern_area, &intern_params, intern_shared->table, NULL);
+    }
+    LWLockRelease(intern_shared->lock);
+    MemoryContextSwitchTo(oldcontext);
+    return true;
+}
+
+/* fill in the ids of the entries made for intern_pending; allocates nothing */
+static void _intern_publish(void)
+{
+    HASH_SEQ_STATUS status;
+    InternEntry     *pending, *entry;
+
+    hash_seq_init(&status, intern_pending);
+    while ((pending = (InternEntry *) hash_seq_search(&status)) != NULL) {
+        entry = (InternEntry *) dshash_find(intern_table, &pending->key, true);
+        if (entry == NULL)
+            continue;
+        // a zobrist collision keeps the first board
+        if (entry->id == 0 && _board_compare((const Board *) entry->board, (const Board *) pending->board) == 0)
+            entry->id = pending->id;
+        dshash_release_lock(intern_table, entry);
+    }
+}
+
+/* remove the entries of intern_pending that never got an id */
+static void _intern_unreserve(void)
+{
+    HASH_SEQ_STATUS status;
+    InternEntry     *pending, *entry;
+
+    hash_seq_init(&status, intern_pending);
+    while ((pending = (InternEntry *) hash_seq_search(&status)) != NULL) {
+        entry = (InternEntry *) dshash_find(intern_table, &pending->key, true);
+        if (entry == NULL)
+            continue;
+        if (entry->id == 0) {
+            dshash_delete_entry(intern_table, entry);
+            pg_atomic_fetch_sub_u64(&intern_shared->entries, 1);
+        } else {
+            dshash_release_lock(intern_table, entry);
+        }
+    }
+}
+
+/* the shared entry for a board found by this transaction, id 0 until it commits */
+static void _intern_reserve(const InternKey *key, const Board *b)
+{
+    InternEntry     *entry;
+    bool            found;
+
+    if (pg_atomic_read_u64(&intern_shared->entries) >= (uint64) chess_index_intern_max)
+        return;
+#if PG_VERSION_NUM >= 170000
+    entry = dshash_find_or_insert_extended(intern_table, key, &found, DSHASH_INSERT_NO_OOM);
+    if (entry == NULL)
+        return;
+#else
+    entry = dshash_find_or_insert(intern_table, key, &found);
+#endif
+    if (!found) {
+        entry->id = 0;
+        memset(entry->board, 0, sizeof(entry->board));
+        memcpy(entry->board, b, VARSIZE(b));
+        pg_atomic_fetch_add_u64(&intern_shared->entries, 1);
+    }
+    dshash_release_lock(intern_table, entry);
+}
+
+static void _intern_xact_callback(XactEvent event, void *arg)
+{
+    if (intern_pending == NULL)
+        return;
+    switch (event) {
+        case XACT_EVENT_COMMIT:
+            if (intern_table != NULL)
+                _intern_publish();
+            hash_destroy(intern_pending);
+            intern_pending = NULL;
+            break;
+        case XACT_EVENT_ABORT:
+        case XACT_EVENT_PREPARE:
+            if (intern_table != NULL)
+                _intern_unreserve();
+            hash_destroy(intern_pending);
+            intern_pending = NULL;
+            break;
+        default:
+            break;
+    }
+}
+
+static void _intern_subxact_callback(SubXactEvent event, SubTransactionId mySubid,
+        SubTransactionId parentSubid, void *arg)
+{
+    if (event == SUBXACT_EVENT_ABORT_SUB && intern_pending != NULL) {
+        if (intern_table != NULL)
+            _intern_unreserve();
+        hash_destroy(intern_pending);
+        intern_pending = NULL;
+    }
+}
+
+static void _intern_init(void)
+{
+    DefineCustomIntVariable("chess_index.intern_max_positions",
+            "Positions kept in the shared position_id table; 0 turns it off.",
+            NULL, &chess_index_intern_max, 1000000, 0, PG_INT32_MAX, PGC_SIGHUP, 0, NULL, NULL, NULL);
+    RegisterXactCallback(_intern_xact_callback, NULL);
+    RegisterSubXactCallback(_intern_subxact_callback, NULL);
+}
+
+/* an entry for key holding board b, or NULL */
+static InternEntry *_intern_pending_find(const InternKey *key, const Board *b)
+{
+    InternEntry     *entry;
+
+    if (intern_pending == NULL)
+        return NULL;
+    entry = (InternEntry *) hash_search(intern_pending, key, HASH_FIND, NULL);
+    if (entry == NULL || _board_compare((const Board *) entry->board, b) != 0)
+        return NULL;
+    return entry;
+}
+
+static void _intern_pending_add(const InternKey *key, int64 id, const Board *b)
+{
+    HASHCTL         ctl;
+    InternEntry     *entry;
+    bool            found;
+
+    if (intern_pending == NULL) {
+        memset(&ctl, 0, sizeof(ctl));
+        ctl.keysize = sizeof(InternKey);
+        ctl.entrysize = sizeof(InternEntry);
+        ctl.hcxt = TopMemoryContext;
+        intern_pending = hash_create("chess_index pending positions", 1024, &ctl,
+                HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+    }
+    if (hash_get_num_entries(intern_pending) >= chess_index_intern_max)
+        return;
+    // a zobrist collision keeps the first board
+    entry = (InternEntry *) hash_search(intern_pending, key, HASH_ENTER, &found);
+    if (!found) {
+        entry->id = id;
+        memset(entry->board, 0, sizeof(entry->board));
+        memcpy(entry->board, b, VARSIZE(b));
+        if (intern_table != NULL)
+            _intern_reserve(key, b);
+    }
+}
+
+static InternCall *_intern_call(FunctionCallInfo fcinfo)
+{
+    InternCall      *call = (InternCall *) fcinfo->flinfo->fn_extra;
+
+    if (call == NULL) {
+        call = MemoryContextAlloc(fcinfo->flinfo->fn_mcxt, sizeof(InternCall));
+        call->extoid = get_extension_oid("chess_index", false);
+        call->nsp = get_func_namespace(fcinfo->flinfo->fn_oid);
+        call->board_oid = _chess_index_type(fcinfo, "board");
+        fcinfo->flinfo->fn_extra = call;
+    }
+    return call;
+}
+
+/*
+ * The plans name the schema and the board type, so they are dropped when a
+ * call comes from another extension (DROP and CREATE EXTENSION) or schema
+ * (ALTER EXTENSION SET SCHEMA).
+ */
+static void _intern_plans_check(const InternCall *call)
+{
+    if (call->extoid == intern_plan_extoid && call->nsp == intern_plan_nsp)
+        return;
+    if (intern_id_plan != NULL)
+        SPI_freeplan(intern_id_plan);
+    if (intern_of_plan != NULL)
+        SPI_freeplan(intern_of_plan);
+    intern_id_plan = NULL;
+    intern_of_plan = NULL;
+    intern_plan_extoid = call->extoid;
+    intern_plan_nsp = call->nsp;
+}
+
+static SPIPlanPtr _intern_prepare(const char *query, Oid nsp, Oid type)
+{
+    char            *schema = get_namespace_name(nsp);
+    SPIPlanPtr      plan;
+
+    plan = SPI_prepare(psprintf(query, quote_identifier(schema), quote_identifier(schema)), 1, &type);
+    if (plan == NULL)
+        CH_ERROR("position interning: SPI_prepare failed: %s", SPI_result_code_string(SPI_result));
+    SPI_keepplan(plan);
+    return plan;
+}
+
+/*
+ * The insert does nothing when the board is already there; the select then
+ * finds it unless a concurrent insert committed after our snapshot, which
+ * the next statement's snapshot sees under read committed.
+ */
+static int64 _intern_lookup(Board *b, const InternCall *call)
+{
+    Datum           values[1] = {PointerGetDatum(b)};
+    bool            isnull;
+    int64           id = 0;
+    int             tries;
+
+    if (SPI_connect() != SPI_OK_CONNECT)
+        CH_ERROR("position_id: SPI_connect failed");
+    _intern_plans_check(call);
+    if (intern_id_plan == NULL)
+        intern_id_plan = _intern_prepare(
+                "with ins as (insert into %s.chess_index_positions (position) values ($1) "
+                "on conflict (position) do nothing returning id) "
+                "select id from ins union all "
+                "select id from %s.chess_index_positions where position = $1 limit 1",
+                call->nsp, call->board_oid);
+    for (tries=0; tries<2; tries++) {
+        if (SPI_execute_plan(intern_id_plan, values, NULL, false, 1) != SPI_OK_SELECT)
+            CH_ERROR("position_id: lookup failed");
+        if (SPI_processed > 0) {
+            id = DatumGetInt64(SPI_getbinval(SPI_tuptable->vals[0], SPI_tuptable->tupdesc, 1, &isnull));
+            break;
+        }
+        CommandCounterIncrement();
+    }
+    SPI_finish();
+    if (tries == 2)
+        ereport(ERROR, (errcode(ERRCODE_T_R_SERIALIZATION_FAILURE),
+                    errmsg("position_id: could not see the concurrently inserted position")));
+    return id;
+}
+
+Datum
+position_id(PG_FUNCTION_ARGS)
+{
+    Board           *b = PG_GETARG_BOARD(0);
+    InternCall      *call = _intern_call(fcinfo);
+    InternKey       key;
+    InternEntry     *entry;
+    int64           id;
+
+    memset(&key, 0, sizeof(key));
+    key.dbid = MyDatabaseId;
+    key.extoid = call->extoid;
+    key.zobrist = _board_zobrist(b);
+
+    if (_intern_attach()) {
+        entry = (InternEntry *) dshash_find(intern_table, &key, false);
+        if (entry != NULL) {
+            id = _board_compare((const Board *) entry->board, b) == 0 ? entry->id : 0;
+            dshash_release_lock(intern_table, entry);
+            if (id)
+                PG_RETURN_INT64(id);
+        }
+    }
+    if ((entry = _intern_pending_find(&key, b)) != NULL)
+        PG_RETURN_INT64(entry->id);
+
+    id = _intern_lookup(b, call);
+    _intern_pending_add(&key, id, b);
+    PG_RETURN_INT64(id);
+}
+
+Datum
+position_of(PG_FUNCTION_ARGS)
+{
+    InternCall      *call = _intern_call(fcinfo);
+    Datum           values[1] = {PG_GETARG_DATUM(0)};
+    Datum           result = (Datum) 0;
+    bool            isnull = true;
+
+    if (SPI_connect() != SPI_OK_CONNECT)
+        CH_ERROR("position_of: SPI_connect failed");
+    _intern_plans_check(call);
+    if (intern_of_plan == NULL)
+        intern_of_plan = _intern_prepare("select position from %s.chess_index_positions where id = $1",
+                call->nsp, INT8OID);
+    if (SPI_execute_plan(intern_of_plan, values, NULL, true, 1) != SPI_OK_SELECT)
+        CH_ERROR("position_of: lookup failed");
+    if (SPI_processed > 0)
+        result = SPI_getbinval(SPI_tuptable->vals[0], SPI_tuptable->tupdesc, 1, &isnull);
+    if (!isnull)
+        result = SPI_datumTransfer(result, false, -1);
+    SPI_finish();
+    if (isnull)
+        PG_RETURN_NULL();
+    PG_RETURN_DATUM(result);
+}
+/*}}}*/
+/********************************************************
+ * 		move generation
+ ********************************************************/
+/*{{{*/
+
+/*
+ * Working form of a board for move generation: a bitboard per piece type
+ * and side plus a mailbox, all in square numbering (a1=0). Boards are
+ * decoded once and only encoded again for the positions handed back.
+ */
+typedef struct {
+    uint64                pieces[CPIECE_MAX];
+    uint64                side[2];              // by side_type
+    char                  mailbox[SQUARE_MAX];  // cpiece_type or NO_CPIECE
+    side_type             go;
+    unsigned char         castle;               // CASTLE_* rights
+    char                  enpassant;            // square of the pawn that can be taken or -1
+} Position;
+
+typedef struct {
+    char                  from;
+    char                  to;
+    char                  piece;                // cpiece_type that moves
+    char                  promotion;            // cpiece_type or NO_CPIECE
+    unsigned char         flags;
+} Move;
+
+#define NO_CPIECE -1
+#define MOVES_MAX 256 // most known legal moves in a position is 218
+
+#define CASTLE_WK 0x1
+#define CASTLE_WQ 0x2
+#define CASTLE_BK 0x4
+#define CASTLE_BQ 0x8
+
+#define MOVE_CAPTURE 0x1
+#define MOVE_ENPASSANT 0x2
+#define MOVE_CASTLE 0x4
+#define MOVE_DOUBLE 0x8
+
+#define SQUARE_BIT(s) (1ull << (s))
+#define OTHER_SIDE(go) ((go) == WHITE ? BLACK : WHITE)
+#define CPIECE(go, p) ((go) == WHITE ? (p) - PAWN : (p) - PAWN + BLACK_PAWN)
+#define CPIECE_SIDE(p) ((p) < BLACK_PAWN ? WHITE : BLACK)
+
+typedef enum            {NORTH, NORTH_EAST, EAST, SOUTH_EAST, SOUTH, SOUTH_WEST, WEST, NORTH_WEST, DIRECTION_MAX} direction_type;
+static const int        DIRECTION_FILE[] = {0, 1, 1, 1, 0, -1, -1, -1};
+static const int        DIRECTION_RANK[] = {1, 1, 0, -1, -1, -1, 0, 1};
+static const int        KNIGHT_FILE[] = {1, 2, 2, 1, -1, -2, -2, -1};
+static const int        KNIGHT_RANK[] = {2, 1, -1, -2, -2, -1, 1, 2};
+static const piece_type PROMOTIONS[] = {QUEEN, ROOK, BISHOP, KNIGHT};
+
+// filled on load
+static uint64           knight_attacks[SQUARE_MAX];
+static uint64           king_attacks[SQUARE_MAX];
+static uint64           pawn_attacks[2][SQUARE_MAX];            // squares a pawn of side_type attacks
+static uint64           ray_attacks[DIRECTION_MAX][SQUARE_MAX]; // up to the edge of the board
+static unsigned char    castle_keep[SQUARE_MAX];                // rights left when a square is touched
+
+static uint64 _step(int s, int df, int dr)
+{
+    int             f = TO_FILE(s) + df, r = TO_RANK(s) + dr;
+
+    if (f < 0 || f > 7 || r < 0 || r > 7)
+        return 0;
+    return SQUARE_BIT(r * 8 + f);
+}
+
+static void _attacks_init(void)
+{
+    int             s, i, n;
+    uint64          bit;
+
+    for (s=0; s<SQUARE_MAX; s++) {
+        for (i=0; i<8; i++) {
+            knight_attacks[s] |= _step(s, KNIGHT_FILE[i], KNIGHT_RANK[i]);
+            king_attacks[s] |= _step(s, DIRECTION_FILE[i], DIRECTION_RANK[i]);
+        }
+        pawn_attacks[WHITE][s] = _step(s, -1, 1) | _step(s, 1, 1);
+        pawn_attacks[BLACK][s] = _step(s, -1, -1) | _step(s, 1, -1);
+        for (i=0; i<DIRECTION_MAX; i++)
+            for (n=1; (bit = _step(s, DIRECTION_FILE[i] * n, DIRECTION_RANK[i] * n)); n++)
+                ray_attacks[i][s] |= bit;
+        castle_keep[s] = CASTLE_WK | CASTLE_WQ | CASTLE_BK | CASTLE_BQ;
+    }
+    castle_keep[0] &= ~CASTLE_WQ;
+    castle_keep[4] &= ~(CASTLE_WK | CASTLE_WQ);
+    castle_keep[7] &= ~CASTLE_WK;
+    castle_keep[56] &= ~CASTLE_BQ;
+    castle_keep[60] &= ~(CASTLE_BK | CASTLE_BQ);
+    castle_keep[63] &= ~CASTLE_BK;
+}
+
+/* the nearest occupied square from s in direction d, or -1 */
+static int _ray_blocker(direction_type d, int s, uint64 occupied)
+{
+    uint64          blockers = ray_attacks[d][s] & occupied;
+
+    if (!blockers)
+        return -1;
+    // these directions count up from the square
+    if (d == NORTH || d == NORTH_EAST || d == EAST || d == NORTH_WEST)
+        return pg_rightmost_one_pos64(blockers);
+    return pg_leftmost_one_pos64(blockers);
+}
+
+/* a ray stops at the first blocker, which it includes */
+static uint64 _ray(direction_type d, int s, uint64 occupied)
+{
+    int             blocker = _ray_blocker(d, s, occupied);
+
+    if (blocker < 0)
+        return ray_attacks[d][s];
+    return ray_attacks[d][s] ^ ray_attacks[d][blocker];
+}
+
+static uint64 _bishop_attacks(int s, uint64 occupied)
+{
+    return _ray(NORTH_EAST, s, occupied) | _ray(SOUTH_EAST, s, occupied)
+        | _ray(SOUTH_WEST, s, occupied) | _ray(NORTH_WEST, s, occupied);
+}
+
+static uint64 _rook_attacks(int s, uint64 occupied)
+{
+    return _ray(NORTH, s, occupied) | _ray(EAST, s, occupied)
+        | _ray(SOUTH, s, occupied) | _ray(WEST, s, occupied);
+}
+
+/* pieces of side by that attack square s */
+static uint64 _position_attackers(const Position *pos, int s, side_type by, uint64 occupied)
+{
+    const uint64    *p = pos->pieces;
+    uint64          diagonal = p[CPIECE(by, BISHOP)] | p[CPIECE(by, QUEEN)];
+    uint64          straight = p[CPIECE(by, ROOK)] | p[CPIECE(by, QUEEN)];
+    uint64          result;
+
+    result = (pawn_attacks[OTHER_SIDE(by)][s] & p[CPIECE(by, PAWN)])
+        | (knight_attacks[s] & p[CPIECE(by, KNIGHT)])
+        | (king_attacks[s] & p[CPIECE(by, KING)]);
+    if (diagonal)
+        result |= _bishop_attacks(s, occupied) & diagonal;
+    if (straight)
+        result |= _rook_attacks(s, occupied) & straight;
+    return result;
+}
+
+static bool _position_attacked(const Position *pos, int s, side_type by)
+{
+    return _position_attackers(pos, s, by, pos->side[WHITE] | pos->side[BLACK]) != 0;
+}
+
+/* every square attacked (or defended) by side by */
+static uint64 _position_attacks(const Position *pos, side_type by)
+{
+    const uint64    *p = pos->pieces;
+    uint64          occupied = pos->side[WHITE] | pos->side[BLACK], bb, result = 0;
+
+    for (bb = p[CPIECE(by, PAWN)]; bb; bb &= bb - 1)
+        result |= pawn_attacks[by][pg_rightmost_one_pos64(bb)];
+    for (bb = p[CPIECE(by, KNIGHT)]; bb; bb &= bb - 1)
+        result |= knight_attacks[pg_rightmost_one_pos64(bb)];
+    for (bb = p[CPIECE(by, KING)]; bb; bb &= bb - 1)
+        result |= king_attacks[pg_rightmost_one_pos64(bb)];
+    for (bb = p[CPIECE(by, BISHOP)] | p[CPIECE(by, QUEEN)]; bb; bb &= bb - 1)
+        result |= _bishop_attacks(pg_rightmost_one_pos64(bb), occupied);
+    for (bb = p[CPIECE(by, ROOK)] | p[CPIECE(by, QUEEN)]; bb; bb &= bb - 1)
+        result |= _rook_attacks(pg_rightmost_one_pos64(bb), occupied);
+    return result;
+}
+
+/*
+ * Pieces of side go that are the only piece between their king and an
+ * enemy slider on the same line.
+ */
+static uint64 _position_pinned(const Position *pos, side_type go)
+{
+    side_type       them = OTHER_SIDE(go);
+    uint64          occupied = pos->side[WHITE] | pos->side[BLACK], sliders, result = 0;
+    uint64          diagonal = pos->pieces[CPIECE(them, BISHOP)] | pos->pieces[CPIECE(them, QUEEN)];
+    uint64          straight = pos->pieces[CPIECE(them, ROOK)] | pos->pieces[CPIECE(them, QUEEN)];
+    int             king, d, first, second;
+
+    if (!pos->pieces[CPIECE(go, KING)])
+        return 0;
+    king = pg_rightmost_one_pos64(pos->pieces[CPIECE(go, KING)]);
+    for (d=0; d<DIRECTION_MAX; d++) {
+        sliders = d % 2 ? diagonal : straight;
+        if (!(ray_attacks[d][king] & sliders))
+            continue;
+        first = _ray_blocker(d, king, occupied);
+        if (first < 0 || !(pos->side[go] & SQUARE_BIT(first)))
+            continue;
+        second = _ray_blocker(d, first, occupied);
+        if (second > -1 && (sliders & SQUARE_BIT(second)))
+            result |= SQUARE_BIT(first);
+    }
+    return result;
+}
+
+static void _position_from_board(Position *pos, const Board *b)
+{
+    uint64          bb = b->board;
+    int             i, s, k = 0;
+    char            p;
+
+    memset(pos, 0, sizeof(Position));
+    memset(pos->mailbox, NO_CPIECE, SQUARE_MAX);
+    while (bb) {
+        i = pg_leftmost_one_pos64(bb);
+        bb &= ~(1ull << i);
+        s = TO_SQUARE_IDX(i);
+        p = GET_PIECE(b->pieces, k);
+        k++;
+        pos->pieces[(int) p] |= SQUARE_BIT(s);
+        pos->side[CPIECE_SIDE(p)] |= SQUARE_BIT(s);
+        pos->mailbox[s] = p;
+    }
+    pos->go = b->whitesgo ? WHITE : BLACK;
+    pos->castle = (b->wk ? CASTLE_WK : 0) | (b->wq ? CASTLE_WQ : 0)
+        | (b->bk ? CASTLE_BK : 0) | (b->bq ? CASTLE_BQ : 0);
+    pos->enpassant = b->enpassant;
+}
+
+/* fills zeroed memory of BOARD_SIZE(pieces on the board) bytes */
+static void _position_fill_board(const Position *pos, Board *result)
+{
+    int             i, s, k = 0, pcount = pg_popcount64(pos->side[WHITE] | pos->side[BLACK]);
+
+    SET_VARSIZE(result, BOARD_SIZE(pcount));
+    result->pcount = pcount;
+    result->version = BOARD_VERSION;
+    // pieces are ordered from the high bit down
+    for (i=SQUARE_MAX-1; i>=0; i--) {
+        s = TO_SQUARE_IDX(i);
+        if (pos->mailbox[s] == NO_CPIECE)
+            continue;
+        result->board |= 1ull << i;
+        SET_PIECE(result->pieces, k, pos->mailbox[s]);
+        k++;
+    }
+    result->whitesgo = pos->go == WHITE;
+    result->wk = (pos->castle & CASTLE_WK) != 0;
+    result->wq = (pos->castle & CASTLE_WQ) != 0;
+    result->bk = (pos->castle & CASTLE_BK) != 0;
+    result->bq = (pos->castle & CASTLE_BQ) != 0;
+    result->enpassant = pos->enpassant;
+}
+
+static Board *_position_to_board(const Position *pos)
+{
+    Board           *result = (Board *) palloc0(BOARD_SIZE(pg_popcount64(pos->side[WHITE] | pos->side[BLACK])));
+
+    _position_fill_board(pos, result);
+    return result;
+}
+
+static uint64 _position_zobrist(const Position *pos)
+{
+    uint64              key = 0, bb;
+    int                 p;
+
+    for (p=0; p<CPIECE_MAX; p++)
+        for (bb = pos->pieces[p]; bb; bb &= bb - 1)
+            key ^= zobrist_pieces[p][pg_rightmost_one_pos64(bb)];
+    if (pos->go == BLACK)               key ^= zobrist_black;
+    if (pos->castle & CASTLE_WK)        key ^= zobrist_castle[0];
+    if (pos->castle & CASTLE_WQ)        key ^= zobrist_castle[1];
+    if (pos->castle & CASTLE_BK)        key ^= zobrist_castle[2];
+    if (pos->castle & CASTLE_BQ)        key ^= zobrist_castle[3];
+    if (pos->enpassant > -1)
+        key ^= zobrist_enpassant[TO_FILE(pos->enpassant)];
+    return key;
+}
+
+/*
+ * Expanded boards: a Position held as a Postgres expanded object, so a
+ * board passed from one function to the next (or kept in a plpgsql
+ * variable) is decoded once. It is flattened back to a Board on storage.
+ */
+#define EB_MAGIC 0x42434845 // "EHCB"
+
+typedef struct {
+    ExpandedObjectHeader  hdr;
+    int                   magic;
+    Position              pos;
+} ExpandedBoard;
+
+static Size _eb_get_flat_size(ExpandedObjectHeader *eohptr)
+{
+    ExpandedBoard   *eb = (ExpandedBoard *) eohptr;
+
+    Assert(eb->magic == EB_MAGIC);
+    return BOARD_SIZE(pg_popcount64(eb->pos.side[WHITE] | eb->pos.side[BLACK]));
+}
+
+static void _eb_flatten_into(ExpandedObjectHeader *eohptr, void *result, Size allocated_size)
+{
+    ExpandedBoard   *eb = (ExpandedBoard *) eohptr;
+
+    Assert(eb->magic == EB_MAGIC);
+    memset(result, 0, allocated_size);
+    _position_fill_board(&eb->pos, (Board *) result);
+}
+
+static const ExpandedObjectMethods EB_methods = {
+    _eb_get_flat_size,
+    _eb_flatten_into
+};
+
+static ExpandedBoard *_board_expand(Datum d, MemoryContext parent)
+{
+    MemoryContext   objcxt = AllocSetContextCreate(parent, "expanded board", ALLOCSET_SMALL_SIZES);
+    ExpandedBoard   *eb = (ExpandedBoard *) MemoryContextAlloc(objcxt, sizeof(ExpandedBoard));
+
+    EOH_init_header(&eb->hdr, &EB_methods, objcxt);
+    eb->magic = EB_MAGIC;
+    if (VARATT_IS_EXTERNAL_EXPANDED(DatumGetPointer(d)))
+        eb->pos = ((ExpandedBoard *) DatumGetEOHP(d))->pos;
+    else
+        _position_from_board(&eb->pos, _board_get(d));
+    return eb;
+}
+
+/* the position of a board datum, decoded into buf unless it is expanded */
+static const Position *_position_get(Datum d, Position *buf)
+{
+    if (VARATT_IS_EXTERNAL_EXPANDED(DatumGetPointer(d)))
+        return &((ExpandedBoard *) DatumGetEOHP(d))->pos;
+    _position_from_board(buf, _board_get(d));
+    return buf;
+}
+
+#define PG_GETARG_POSITION(n, buf) _position_get(PG_GETARG_DATUM(n), buf)
+
+/*
+ * The readers below keep the last position they decoded in fn_extra, so
+ * a call site fed the same board row after row (attackers over each
+ * square, say) decodes it once. Compared by value: a new row may be
+ * detoasted at the address of the last one.
+ */
+typedef struct {
+    char                  board[BOARD_SIZE(PIECES_MAX)];
+    Position              pos;
+} PositionCache;
+
+static const Position *_position_cached(FunctionCallInfo fcinfo, int n)
+{
+    Datum           d = PG_GETARG_DATUM(n);
+    PositionCache   *cache = (PositionCache *) fcinfo->flinfo->fn_extra;
+    const Board     *b;
+
+    if (VARATT_IS_EXTERNAL_EXPANDED(DatumGetPointer(d)))
+        return &((ExpandedBoard *) DatumGetEOHP(d))->pos;
+    b = _board_get(d);
+    if (cache == NULL) {
+        cache = MemoryContextAllocZero(fcinfo->flinfo->fn_mcxt, sizeof(PositionCache));
+        fcinfo->flinfo->fn_extra = cache;
+    } else if (VARSIZE(cache->board) == VARSIZE(b)
+            && memcmp(cache->board, b, VARSIZE(b)) == 0) {
+        return &cache->pos;
+    }
+    memcpy(cache->board, b, VARSIZE(b));
+    _position_from_board(&cache->pos, b);
+    return &cache->pos;
+}
+
+#define PG_GETARG_POSITION_CACHED(n) _position_cached(fcinfo, n)
+
+static uint64 _position_material(const Position *pos)
+{
+    uint64          result = 0;
+    int             p;
+
+    for (p=0; p<CPIECE_MAX; p++)
+        MATERIAL_ADD(result, p, pg_popcount64(pos->pieces[p]));
+    return result;
+}
+
+static uint64 _board_datum_material(Datum d)
+{
+    if (VARATT_IS_EXTERNAL_EXPANDED(DatumGetPointer(d)))
+        return _position_material(&((ExpandedBoard *) DatumGetEOHP(d))->pos);
+    return _board_material(_board_get(d));
+}
+
+static void _board_datum_pawns(Datum d, PawnKey *key)
+{
+    const Position  *pos;
+
+    if (VARATT_IS_EXTERNAL_EXPANDED(DatumGetPointer(d))) {
+        pos = &((ExpandedBoard *) DatumGetEOHP(d))->pos;
+        key->pawns[WHITE] = pos->pieces[WHITE_PAWN];
+        key->pawns[BLACK] = pos->pieces[BLACK_PAWN];
+    } else
+        _board_pawns(_board_get(d), key);
+}
+
+/* expanded boards hash from their bitboards without being flattened */
+static uint64 _board_datum_zobrist(Datum d)
+{
+    if (VARATT_IS_EXTERNAL_EXPANDED(DatumGetPointer(d)))
+        return _position_zobrist(&((ExpandedBoard *) DatumGetEOHP(d))->pos);
+    return _board_zobrist(_board_get(d));
+}
+
+/* size of the board as stored, for the stats */
+static uint64 _board_datum_bytes(Datum d)
+{
+    Position        *pos;
+
+    if (VARATT_IS_EXTERNAL_EXPANDED(DatumGetPointer(d))) {
+        pos = &((ExpandedBoard *) DatumGetEOHP(d))->pos;
+        return BOARD_SIZE(pg_popcount64(pos->side[WHITE] | pos->side[BLACK]));
+    }
+    return VARSIZE_ANY(DatumGetPointer(d));
+}
+
+static void _position_remove(Position *pos, int s)
+{
+    char            p = pos->mailbox[s];
+
+    pos->pieces[(int) p] &= ~SQUARE_BIT(s);
+    pos->side[CPIECE_SIDE(p)] &= ~SQUARE_BIT(s);
+    pos->mailbox[s] = NO_CPIECE;
+}
+
+static void _position_put(Position *pos, int s, char p)
+{
+    pos->pieces[(int) p] |= SQUARE_BIT(s);
+    pos->side[CPIECE_SIDE(p)] |= SQUARE_BIT(s);
+    pos->mailbox[s] = p;
+}
+
+/*
+ * The move is expected to come from _position_moves. Enpassant is only
+ * kept after a double step when an enemy pawn could take, so that the
+ * same position reached by different moves compares equal.
+ */
+static void _position_make(Position *pos, const Move *m)
+{
+    side_type       go = pos->go, them = OTHER_SIDE(go);
+    int             passed;
+
+    if (m->flags & MOVE_ENPASSANT)
+        _position_remove(pos, pos->enpassant);
+    else if (pos->mailbox[(int) m->to] != NO_CPIECE)
+        _position_remove(pos, m->to);
+    _position_remove(pos, m->from);
+    _position_put(pos, m->to, m->promotion == NO_CPIECE ? m->piece : m->promotion);
+
+    if (m->flags & MOVE_CASTLE) {
+        // the rook goes to the other side of the king
+        if (m->to > m->from) {
+            _position_remove(pos, m->to + 1);
+            _position_put(pos, m->to - 1, CPIECE(go, ROOK));
+        } else {
+            _position_remove(pos, m->to - 2);
+            _position_put(pos, m->to + 1, CPIECE(go, ROOK));
+        }
+    }
+
+    pos->castle &= castle_keep[(int) m->from] & castle_keep[(int) m->to];
+    pos->enpassant = -1;
+    if (m->flags & MOVE_DOUBLE) {
+        passed = (m->from + m->to) / 2;
+        if (pawn_attacks[go][passed] & pos->pieces[CPIECE(them, PAWN)])
+            pos->enpassant = m->to;
+    }
+    pos->go = them;
+}
+
+static int _add_moves(Move *moves, int n, int from, uint64 targets, char piece, uint64 enemy)
+{
+    int             to;
+
+    while (targets) {
+        to = pg_rightmost_one_pos64(targets);
+        targets &= targets - 1;
+        moves[n].from = from;
+        moves[n].to = to;
+        moves[n].piece = piece;
+        moves[n].promotion = NO_CPIECE;
+        moves[n].flags = enemy & SQUARE_BIT(to) ? MOVE_CAPTURE : 0;
+        n++;
+    }
+    return n;
+}
+
+static int _add_pawn_moves(Move *moves, int n, int from, uint64 targets, side_type go, uint64 enemy)
+{
+    int             to, i;
+    unsigned char   flags;
+
+    while (targets) {
+        to = pg_rightmost_one_pos64(targets);
+        targets &= targets - 1;
+        flags = enemy & SQUARE_BIT(to) ? MOVE_CAPTURE : 0;
+        if (to - from == 16 || from - to == 16)
+            flags |= MOVE_DOUBLE;
+        for (i=0; i<4; i++) {
+            moves[n].from = from;
+            moves[n].to = to;
+            moves[n].piece = CPIECE(go, PAWN);
+            moves[n].flags = flags;
+            if (TO_RANK(to) != 0 && TO_RANK(to) != 7) {
+                moves[n++].promotion = NO_CPIECE;
+                break;
+            }
+            moves[n++].promotion = CPIECE(go, PROMOTIONS[i]);
+        }
+    }
+    return n;
+}
+
+/* the king and rook are in place, nothing between them and no check on the way */
+static bool _can_castle(const Position *pos, int king, int rook, uint64 between, int step)
+{
+    side_type       go = pos->go, them = OTHER_SIDE(go);
+
+    return pos->mailbox[king] == CPIECE(go, KING)
+        && pos->mailbox[rook] == CPIECE(go, ROOK)
+        && ((pos->side[WHITE] | pos->side[BLACK]) & between) == 0
+        && !_position_attacked(pos, king, them)
+        && !_position_attacked(pos, king + step, them)
+        && !_position_attacked(pos, king + 2 * step, them);
+}
+
+/* moves that follow the piece rules but may leave the king in check */
+static int _position_pseudo_moves(const Position *pos, Move *moves)
+{
+    side_type       go = pos->go;
+    uint64          own = pos->side[go], enemy = pos->side[OTHER_SIDE(go)];
+    uint64          occupied = own | enemy, bb, targets;
+    int             from, forward = go == WHITE ? 8 : -8, base = go == WHITE ? 0 : 56, n = 0;
+
+    for (bb = pos->pieces[CPIECE(go, PAWN)]; bb; bb &= bb - 1) {
+        from = pg_rightmost_one_pos64(bb);
+        targets = pawn_attacks[go][from] & enemy;
+        if (TO_RANK(from) != (go == WHITE ? 7 : 0) && !(occupied & SQUARE_BIT(from + forward))) {
+            targets |= SQUARE_BIT(from + forward);
+            if (TO_RANK(from) == (go == WHITE ? 1 : 6) && !(occupied & SQUARE_BIT(from + 2 * forward)))
+                targets |= SQUARE_BIT(from + 2 * forward);
+        }
+        n = _add_pawn_moves(moves, n, from, targets, go, enemy);
+        if (pos->enpassant > -1 && pos->mailbox[(int) pos->enpassant] == CPIECE(OTHER_SIDE(go), PAWN)
+                && (pawn_attacks[go][from] & SQUARE_BIT(pos->enpassant + forward))) {
+            moves[n].from = from;
+            moves[n].to = pos->enpassant + forward;
+            moves[n].piece = CPIECE(go, PAWN);
+            moves[n].promotion = NO_CPIECE;
+            moves[n].flags = MOVE_CAPTURE | MOVE_ENPASSANT;
+            n++;
+        }
+    }
+    for (bb = pos->pieces[CPIECE(go, KNIGHT)]; bb; bb &= bb - 1) {
+        from = pg_rightmost_one_pos64(bb);
+        n = _add_moves(moves, n, from, knight_attacks[from] & ~own, CPIECE(go, KNIGHT), enemy);
+    }
+    for (bb = pos->pieces[CPIECE(go, BISHOP)]; bb; bb &= bb - 1) {
+        from = pg_rightmost_one_pos64(bb);
+        n = _add_moves(moves, n, from, _bishop_attacks(from, occupied) & ~own, CPIECE(go, BISHOP), enemy);
+    }
+    for (bb = pos->pieces[CPIECE(go, ROOK)]; bb; bb &= bb - 1) {
+        from = pg_rightmost_one_pos64(bb);
+        n = _add_moves(moves, n, from, _rook_attacks(from, occupied) & ~own, CPIECE(go, ROOK), enemy);
+    }
+    for (bb = pos->pieces[CPIECE(go, QUEEN)]; bb; bb &= bb - 1) {
+        from = pg_rightmost_one_pos64(bb);
+        n = _add_moves(moves, n, from, (_bishop_attacks(from, occupied) | _rook_attacks(from, occupied)) & ~own,
+                CPIECE(go, QUEEN), enemy);
+    }
+    for (bb = pos->pieces[CPIECE(go, KING)]; bb; bb &= bb - 1) {
+        from = pg_rightmost_one_pos64(bb);
+        n = _add_moves(moves, n, from, king_attacks[from] & ~own, CPIECE(go, KING), enemy);
+    }
+
+    if ((pos->castle & (go == WHITE ? CASTLE_WK : CASTLE_BK))
+            && _can_castle(pos, base + 4, base + 7, SQUARE_BIT(base + 5) | SQUARE_BIT(base + 6), 1)) {
+        n = _add_moves(moves, n, base + 4, SQUARE_BIT(base + 6), CPIECE(go, KING), 0);
+        moves[n-1].flags = MOVE_CASTLE;
+    }
+    if ((pos->castle & (go == WHITE ? CASTLE_WQ : CASTLE_BQ))
+            && _can_castle(pos, base + 4, base, SQUARE_BIT(base + 1) | SQUARE_BIT(base + 2) | SQUARE_BIT(base + 3), -1)) {
+        n = _add_moves(moves, n, base + 4, SQUARE_BIT(base + 2), CPIECE(go, KING), 0);
+        moves[n-1].flags = MOVE_CASTLE;
+    }
+    return n;
+}
+
+/*
+ * Legal moves: each pseudo legal move is made on a copy of the position
+ * and dropped if it leaves the own king attacked. Positions without a
+ * king (patterns) are never in check.
+ */
+static int _position_moves(const Position *pos, Move *moves)
+{
+    Move            pseudo[MOVES_MAX];
+    Position        next;
+    uint64          king;
+    int             i, n, result = 0;
+
+    n = _position_pseudo_moves(pos, pseudo);
+    for (i=0; i<n; i++) {
+        next = *pos;
+        _position_make(&next, &pseudo[i]);
+        king = next.pieces[CPIECE(pos->go, KING)];
+        if (king && _position_attacked(&next, pg_rightmost_one_pos64(king), next.go))
+            continue;
+        moves[result++] = pseudo[i];
+    }
+    return result;
+}
+
+static bool _is_uci(const char *str, int len)
+{
+    return (len == 4 || (len == 5 && strchr("qrbnQRBN", str[4])))
+        && str[0] >= 'a' && str[0] <= 'h' && str[1] >= '1' && str[1] <= '8'
+        && str[2] >= 'a' && str[2] <= 'h' && str[3] >= '1' && str[3] <= '8';
+}
+
+/*
+ * The legal move written as uci (e2e4, e7e8q) or san (e4, Nbd7, exd5,
+ * e8=Q, O-O). Check marks and annotations at the end are ignored.
+ */
+static Move _position_find_move(const Position *pos, const char *str)
+{
+    Move            moves[MOVES_MAX], result;
+    char            buf[16];
+    size_t          len = strlen(str);
+    int             i, n, end, found = 0;
+    int             from_file = -1, from_rank = -1, to;
+    piece_type      piece = PAWN, promotion = NO_PIECE;
+    int             base = pos->go == WHITE ? 0 : 56;
+
+    while (len > 0 && strchr("+#!?", str[len-1]))
+        len--;
+    if (len < 2 || len >= sizeof(buf))
+        BAD_TYPE_IN("move", str);
+    memcpy(buf, str, len);
+    buf[len] = '\0';
+
+    if (strcmp(buf, "O-O") == 0 || strcmp(buf, "0-0") == 0) {
+        piece = KING;
+        from_file = 4;
+        to = base + 6;
+    } else if (strcmp(buf, "O-O-O") == 0 || strcmp(buf, "0-0-0") == 0) {
+        piece = KING;
+        from_file = 4;
+        to = base + 2;
+    } else if (_is_uci(buf, len)) {
+        piece = NO_PIECE; // any
+        from_file = buf[0] - 'a';
+        from_rank = buf[1] - '1';
+        to = _square_in(buf[2], buf[3]);
+        if (len == 5)
+            promotion = _piece_type_in(buf[4]);
+    } else {
+        i = 0;
+        if (strchr("NBRQK", buf[0]))
+            piece = _piece_type_in(buf[i++]);
+        end = len;
+        // a pawn move can only end in a letter when it promotes
+        if (piece == PAWN && strchr("NBRQnbrq", buf[end-1])) {
+            promotion = _piece_type_in(buf[--end]);
+            if (end > 0 && buf[end-1] == '=')
+                end--;
+        }
+        if (end - i < 2)
+            BAD_TYPE_IN("move", str);
+        to = _square_in(buf[end-2], buf[end-1]);
+        for (end-=2; i<end; i++) {
+            if (buf[i] >= 'a' && buf[i] <= 'h')
+                from_file = buf[i] - 'a';
+            else if (buf[i] >= '1' && buf[i] <= '8')
+                from_rank = buf[i] - '1';
+            else if (buf[i] != 'x' && buf[i] != ':' && buf[i] != '-')
+                BAD_TYPE_IN("move", str);
+        }
+    }
+
+    n = _position_moves(pos, moves);
+    for (i=0; i<n; i++) {
+        if (moves[i].to != to)
+            continue;
+        if (piece != NO_PIECE && _piece_type(moves[i].piece) != piece)
+            continue;
+        if (from_file > -1 && TO_FILE(moves[i].from) != from_file)
+            continue;
+        if (from_rank > -1 && TO_RANK(moves[i].from) != from_rank)
+            continue;
+        if (moves[i].promotion == NO_CPIECE ? promotion != NO_PIECE : _piece_type(moves[i].promotion) != promotion)
+            continue;
+        result = moves[i];
+        found++;
+    }
+    if (found == 0)
+        CH_ERROR("illegal move: %s", str);
+    if (found > 1)
+        CH_ERROR("ambiguous move: %s", str);
+    return result;
+}
+
+typedef struct {
+    Position              pos;
+    Move                  moves[MOVES_MAX];
+} MovesState;
+
+Datum
+moves(PG_FUNCTION_ARGS)
+{
+    FuncCallContext *funcctx;
+    MovesState      *state;
+    const Move      *m;
+    Position        buf, next;
+    MemoryContext   oldcontext;
+    TupleDesc       tupdesc;
+    Datum           values[5];
+    bool            nulls[5] = {false, false, false, false, false};
+
+    if (SRF_IS_FIRSTCALL()) {
+        funcctx = SRF_FIRSTCALL_INIT();
+        oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+        if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+            CH_ERROR("moves: return type must be a row type");
+        funcctx->tuple_desc = BlessTupleDesc(tupdesc);
+        state = (MovesState *) palloc(sizeof(MovesState));
+        state->pos = *PG_GETARG_POSITION(0, &buf);
+        funcctx->max_calls = _position_moves(&state->pos, state->moves);
+        funcctx->user_fctx = state;
+        MemoryContextSwitchTo(oldcontext);
+    }
+
+    funcctx = SRF_PERCALL_SETUP();
+    state = (MovesState *) funcctx->user_fctx;
+    if (funcctx->call_cntr >= funcctx->max_calls)
+        SRF_RETURN_DONE(funcctx);
+
+    m = &state->moves[funcctx->call_cntr];
+    next = state->pos;
+    _position_make(&next, m);
+    values[0] = CharGetDatum(m->from);
+    values[1] = CharGetDatum(m->to);
+    values[2] = CharGetDatum(m->promotion);
+    nulls[2] = m->promotion == NO_CPIECE;
+    values[3] = CharGetDatum(m->piece);
+    values[4] = PointerGetDatum(_position_to_board(&next));
+    SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(heap_form_tuple(funcctx->tuple_desc, values, nulls)));
+}
+
+Datum
+legal_move_count(PG_FUNCTION_ARGS)
+{
+    const Position  *pos = PG_GETARG_POSITION_CACHED(0);
+    Move            moves[MOVES_MAX];
+
+    PG_RETURN_INT32(_position_moves(pos, moves));
+}
+
+/*
+ * Returns an expanded board. A read-write expanded argument is ours to
+ * change in place, so a chain of applies decodes the board only once; a
+ * read-only one (a plpgsql variable) is copied without decoding.
+ */
+Datum
+board_apply(PG_FUNCTION_ARGS)
+{
+    char            *str = text_to_cstring(PG_GETARG_TEXT_PP(1));
+    ExpandedBoard   *eb;
+    Move            m;
+
+    if (VARATT_IS_EXTERNAL_EXPANDED_RW(PG_GETARG_POINTER(0)))
+        eb = (ExpandedBoard *) DatumGetEOHP(PG_GETARG_DATUM(0));
+    else
+        eb = _board_expand(PG_GETARG_DATUM(0), CurrentMemoryContext);
+    Assert(eb->magic == EB_MAGIC);
+    m = _position_find_move(&eb->pos, str);
+    _position_make(&eb->pos, &m);
+    PG_RETURN_DATUM(EOHPGetRWDatum(&eb->hdr));
+}
+
+Datum
+board_expand(PG_FUNCTION_ARGS)
+{
+    ExpandedBoard   *eb = _board_expand(PG_GETARG_DATUM(0), CurrentMemoryContext);
+    PG_RETURN_DATUM(EOHPGetRWDatum(&eb->hdr));
+}
+
+/*
+ * The moves are applied to one Position kept across calls; a board is
+ * only built for each row returned.
+ */
+typedef struct {
+    Position              pos;
+    Datum                 *elems;
+    bool                  *nulls;
+} ReplayState;
+
+Datum
+replay(PG_FUNCTION_ARGS)
+{
+    FuncCallContext *funcctx;
+    ReplayState     *state;
+    Position        buf;
+    MemoryContext   oldcontext;
+    TupleDesc       tupdesc;
+    Move            m;
+    char            *str;
+    int             n;
+    Datum           values[2];
+    bool            nulls[2] = {false, false};
+
+    if (SRF_IS_FIRSTCALL()) {
+        funcctx = SRF_FIRSTCALL_INIT();
+        oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+        if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+            CH_ERROR("replay: return type must be a row type");
+        funcctx->tuple_desc = BlessTupleDesc(tupdesc);
+        state = (ReplayState *) palloc(sizeof(ReplayState));
+        state->pos = *PG_GETARG_POSITION(0, &buf);
+        deconstruct_array(PG_GETARG_ARRAYTYPE_P(1), TEXTOID, -1, false, TYPALIGN_INT,
+                &state->elems, &state->nulls, &n);
+        // ply 0 is the starting board
+        funcctx->max_calls = n + 1;
+        funcctx->user_fctx = state;
+        MemoryContextSwitchTo(oldcontext);
+    }
+
+    funcctx = SRF_PERCALL_SETUP();
+    state = (ReplayState *) funcctx->user_fctx;
+    if (funcctx->call_cntr >= funcctx->max_calls)
+        SRF_RETURN_DONE(funcctx);
+
+    if (funcctx->call_cntr > 0) {
+        if (state->nulls[funcctx->call_cntr - 1])
+            CH_ERROR("replay: null move at ply %d", (int) funcctx->call_cntr);
+        str = TextDatumGetCString(state->elems[funcctx->call_cntr - 1]);
+        m = _position_find_move(&state->pos, str);
+        _position_make(&state->pos, &m);
+        pfree(str);
+    }
+    values[0] = Int32GetDatum(funcctx->call_cntr);
+    values[1] = PointerGetDatum(_position_to_board(&state->pos));
+    SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(heap_form_tuple(funcctx->tuple_desc, values, nulls)));
+}
+/* leaf nodes depth plies below pos; the last ply is only counted */
+static uint64 _position_perft(const Position *pos, int depth)
+{
+    Move            moves[MOVES_MAX];
+    Position        next;
+    uint64          result = 0;
+    int             i, n;
+
+    if (depth <= 0)
+        return 1;
+    n = _position_moves(pos, moves);
+    if (depth == 1)
+        return n;
+    if (depth > 2)
+        CHECK_FOR_INTERRUPTS();
+    for (i=0; i<n; i++) {
+        next = *pos;
+        _position_make(&next, &moves[i]);
+        result += _position_perft(&next, depth - 1);
+    }
+    return result;
+}
+
+static char *_move_uci(const Move *m, char *str)
+{
+    _square_out(m->from, str);
+    _square_out(m->to, str + 2);
+    str[4] = m->promotion == NO_CPIECE ? '\0' : pg_tolower(_cpiece_type_char(m->promotion));
+    str[5] = '\0';
+    return str;
+}
+
+Datum
+perft(PG_FUNCTION_ARGS)
+{
+    int32           depth = PG_GETARG_INT32(1);
+    const Position  *pos = PG_GETARG_POSITION_CACHED(0);
+
+    if (depth < 0)
+        CH_ERROR("perft: depth must not be negative: %d", depth);
+    PG_RETURN_INT64(_position_perft(pos, depth));
+}
+
+/* perft below each legal move, for finding where two generators differ */
+Datum
+perft_divide(PG_FUNCTION_ARGS)
+{
+    int32           depth = PG_GETARG_INT32(1);
+    ReturnSetInfo   *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+    Position        buf, next;
+    const Position  *pos;
+    Move            moves[MOVES_MAX];
+    char            uci[6];
+    Datum           values[2];
+    bool            nulls[2] = {false, false};
+    int             i, n;
+
+    if (depth < 1)
+        CH_ERROR("perft_divide: depth must be at least 1: %d", depth);
+    InitMaterializedSRF(fcinfo, 0);
+    pos = PG_GETARG_POSITION(0, &buf);
+    n = _position_moves(pos, moves);
+    for (i=0; i<n; i++) {
+        next = *pos;
+        _position_make(&next, &moves[i]);
+        values[0] = PointerGetDatum(cstring_to_text(_move_uci(&moves[i], uci)));
+        values[1] = Int64GetDatum(_position_perft(&next, depth - 1));
+        tuplestore_putvalues(rsinfo->setResult, rsinfo->setDesc, values, nulls);
+    }
+    return (Datum) 0;
+}
+/*}}}*/
+/********************************************************
+ * 		symmetry
+ ********************************************************/
+/*{{{*/
+
+/*
+ * In square numbering a byte swap of a bitboard flips the ranks (s ^ 56)
+ * and reversing the bits of each byte mirrors the files (s ^ 7).
+ */
+static inline uint64 _bitboard_mirror_files(uint64 bb)
+{
+    bb = ((bb >> 1) & 0x5555555555555555ull) | ((bb & 0x5555555555555555ull) << 1);
+    bb = ((bb >> 2) & 0x3333333333333333ull) | ((bb & 0x3333333333333333ull) << 2);
+    return ((bb >> 4) & 0x0f0f0f0f0f0f0f0full) | ((bb & 0x0f0f0f0f0f0f0f0full) << 4);
+}
+
+#define CPIECE_FLIP(p) ((p) < BLACK_PAWN ? (p) + BLACK_PAWN : (p) - BLACK_PAWN)
+
+/* the same position from the other side: ranks flipped, colors and side to move swapped */
+static void _position_flip_colors(const Position *pos, Position *result)
+{
+    int             p, s;
+
+    for (p=0; p<CPIECE_MAX; p++)
+        result->pieces[CPIECE_FLIP(p)] = pg_bswap64(pos->pieces[p]);
+    result->side[WHITE] = pg_bswap64(pos->side[BLACK]);
+    result->side[BLACK] = pg_bswap64(pos->side[WHITE]);
+    for (s=0; s<SQUARE_MAX; s++)
+        result->mailbox[s ^ 56] = pos->mailbox[s] == NO_CPIECE ? NO_CPIECE : CPIECE_FLIP(pos->mailbox[s]);
+    result->go = pos->go == WHITE ? BLACK : WHITE;
+    result->castle = ((pos->castle & (CASTLE_WK | CASTLE_WQ)) << 2) | ((pos->castle & (CASTLE_BK | CASTLE_BQ)) >> 2);
+    result->enpassant = pos->enpassant > -1 ? pos->enpassant ^ 56 : -1;
+}
+
+/* castling rights do not survive the kings and rooks changing wings, so they are dropped */
+static void _position_mirror_files(const Position *pos, Position *result)
+{
+    int             p, s;
+
+    for (p=0; p<CPIECE_MAX; p++)
+        result->pieces[p] = _bitboard_mirror_files(pos->pieces[p]);
+    result->side[WHITE] = _bitboard_mirror_files(pos->side[WHITE]);
+    result->side[BLACK] = _bitboard_mirror_files(pos->side[BLACK]);
+    for (s=0; s<SQUARE_MAX; s++)
+        result->mailbox[s ^ 7] = pos->mailbox[s];
+    result->go = pos->go;
+    result->castle = 0;
+    result->enpassant = pos->enpassant > -1 ? pos->enpassant ^ 7 : -1;
+}
+
+Datum
+flip_colors(PG_FUNCTION_ARGS)
+{
+    Position        buf, result;
+
+    _position_flip_colors(PG_GETARG_POSITION(0, &buf), &result);
+    PG_RETURN_POINTER(_position_to_board(&result));
+}
+
+Datum
+mirror_files(PG_FUNCTION_ARGS)
+{
+    Position        buf, result;
+
+    _position_mirror_files(PG_GETARG_POSITION(0, &buf), &result);
+    PG_RETURN_POINTER(_position_to_board(&result));
+}
+
+/*
+ * A board and its flip_colors differ in the side to move, so the one with
+ * white to move stands for both.
+ */
+Datum
+canonical(PG_FUNCTION_ARGS)
+{
+    Position        buf, result;
+    const Position  *pos = PG_GETARG_POSITION(0, &buf);
+
+    if (pos->go == WHITE)
+        PG_RETURN_DATUM(PG_GETARG_DATUM(0));
+    _position_flip_colors(pos, &result);
+    PG_RETURN_POINTER(_position_to_board(&result));
+}
+/*}}}*/
+/********************************************************
+ * 		attacks
+ ********************************************************/
+/*{{{*/
+
+/*
+ * Masks are returned as int8 in square numbering: bit 0 is a1, bit 63
+ * is h8 (unlike the board bitboard, which runs from a8).
+ */
+
+Datum
+attacks(PG_FUNCTION_ARGS)
+{
+    side_type       by = PG_GETARG_CHAR(1);
+    const Position  *pos = PG_GETARG_POSITION_CACHED(0);
+
+    PG_RETURN_INT64(_position_attacks(pos, by));
+}
+
+Datum
+attackers(PG_FUNCTION_ARGS)
+{
+    char            s = PG_GETARG_CHAR(1);
+    side_type       by = PG_GETARG_CHAR(2);
+    const Position  *pos = PG_GETARG_POSITION_CACHED(0);
+
+    PG_RETURN_INT64(_position_attackers(pos, s, by, pos->side[WHITE] | pos->side[BLACK]));
+}
+
+/* the side to move is in check */
+Datum
+in_check(PG_FUNCTION_ARGS)
+{
+    const Position  *pos = PG_GETARG_POSITION_CACHED(0);
+    uint64          king;
+
+    king = pos->pieces[CPIECE(pos->go, KING)];
+    PG_RETURN_BOOL(king && _position_attacked(pos, pg_rightmost_one_pos64(king), OTHER_SIDE(pos->go)));
+}
+
+Datum
+pinned(PG_FUNCTION_ARGS)
+{
+    side_type       go = PG_GETARG_CHAR(1);
+    const Position  *pos = PG_GETARG_POSITION_CACHED(0);
+
+    PG_RETURN_INT64(_position_pinned(pos, go));
+}
+
+/* pieces of side go, other than the king, attacked and not defended */
+Datum
+hanging(PG_FUNCTION_ARGS)
+{
+    side_type       go = PG_GETARG_CHAR(1);
+    const Position  *pos = PG_GETARG_POSITION_CACHED(0);
+
+    PG_RETURN_INT64(pos->side[go] & ~pos->pieces[CPIECE(go, KING)]
+            & _position_attacks(pos, OTHER_SIDE(go)) & ~_position_attacks(pos, go));
+}
+/*}}}*/
+/********************************************************
+ * 		pgn
+ ********************************************************/
+/*{{{*/
+
+#define PGN_TOKEN_MAX 32
+#define START_FEN "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -"
+
+typedef struct {
+    ReturnSetInfo         *rsinfo;
+    MemoryContext         gamecontext;
+    Position              start;            // the standard start
+    Position              pos;
+    char                  fen[FEN_MAX + 1]; // from a FEN tag of the game, if any
+    int                   game_no;
+    int                   ply;
+    bool                  started;          // movetext of game_no has begun
+} PgnState;
+
+static void _pgn_error_callback(void *arg)
+{
+    PgnState        *state = (PgnState *) arg;
+
+    if (state->started)
+        errcontext("pgn game %d, ply %d", state->game_no, state->ply + 1);
+    else
+        errcontext("pgn game %d", state->game_no + 1);
+}
+
+static void _pgn_emit(PgnState *state, const char *move)
+{
+    Datum           values[4];
+    bool            nulls[4] = {false, false, false, false};
+
+    values[0] = Int32GetDatum(state->game_no);
+    values[1] = Int32GetDatum(state->ply);
+    values[2] = PointerGetDatum(_position_to_board(&state->pos));
+    if (move)
+        values[3] = PointerGetDatum(cstring_to_text(move));
+    else
+        nulls[3] = true;
+    tuplestore_putvalues(state->rsinfo->setResult, state->rsinfo->setDesc, values, nulls);
+}
+
+static void _pgn_game_start(PgnState *state)
+{
+    if (state->started)
+        return;
+    state->game_no++;
+    state->ply = 0;
+    state->started = true;
+    if (state->fen[0])
+        _position_from_board(&state->pos, (Board *) DatumGetPointer(
+                    DirectFunctionCall1(board_in, CStringGetDatum(state->fen))));
+    else
+        state->pos = state->start;
+    _pgn_emit(state, NULL);
+}
+
+/* everything allocated for a game goes with it */
+static void _pgn_game_end(PgnState *state)
+{
+    state->started = false;
+    state->fen[0] = '\0';
+    MemoryContextReset(state->gamecontext);
+}
+
+/* a tag pair; only FEN is used, and one too long for a fen is an error */
+static const char *_pgn_tag(PgnState *state, const char *p, const char *end)
+{
+    const char      *name = ++p, *value = NULL;
+    int             len;
+
+    while (p < end && *p != ']') {
+        if (*p == '"') {
+            value = ++p;
+            while (p < end && *p != '"') {
+                if (*p == '\\' && p + 1 < end)
+                    p++;
+                p++;
+            }
+            len = p - value;
+            if (end - name >= 4 && strncmp(name, "FEN ", 4) == 0) {
+                // the error context names the game
+                if (len > FEN_MAX)
+                    ereport(ERROR, (errcode(ERRCODE_INVALID_TEXT_REPRESENTATION),
+                                errmsg("FEN tag is longer than %d characters", FEN_MAX)));
+                memcpy(state->fen, value, len);
+                state->fen[len] = '\0';
+            }
+        }
+        if (p < end)
+            p++;
+    }
+    return p < end ? p + 1 : p;
+}
+
+/* skips a variation, which may hold comments and more variations */
+static const char *_pgn_skip_variation(const char *p, const char *end)
+{
+    int             depth = 0;
+
+    for (; p < end; p++) {
+        if (*p == '(')
+            depth++;
+        else if (*p == ')' && --depth == 0)
+            return p + 1;
+        else if (*p == '{')
+            while (p + 1 < end && *p != '}')
+                p++;
+    }
+    return p;
+}
+
+static bool _pgn_result(const char *token)
+{
+    return strcmp(token, "1-0") == 0 || strcmp(token, "0-1") == 0
+        || strcmp(token, "1/2-1/2") == 0 || strcmp(token, "*") == 0;
+}
+
+/*
+ * One pass over the text: tags, comments, variations, nags and move
+ * numbers are skipped and each san move is made on a Position, so boards
+ * are built directly without going through fen. A game ends at its
+ * result, at the next tag section or at the end of the text.
+ */
+Datum
+pgn_positions(PG_FUNCTION_ARGS)
+{
+    text            *pgn = PG_GETARG_TEXT_PP(0);
+    const char      *p = VARDATA_ANY(pgn), *end = p + VARSIZE_ANY_EXHDR(pgn), *t;
+    char            token[PGN_TOKEN_MAX];
+    PgnState        state;
+    Move            m;
+    MemoryContext   oldcontext;
+    ErrorContextCallback errcallback;
+    int             len;
+
+    InitMaterializedSRF(fcinfo, 0);
+    memset(&state, 0, sizeof(PgnState));
+    state.rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+    state.gamecontext = AllocSetContextCreate(CurrentMemoryContext, "pgn game", ALLOCSET_DEFAULT_SIZES);
+    _position_from_board(&state.start, (Board *) DatumGetPointer(
+                DirectFunctionCall1(board_in, CStringGetDatum(START_FEN))));
+
+    errcallback.callback = _pgn_error_callback;
+    errcallback.arg = &state;
+    errcallback.previous = error_context_stack;
+    error_context_stack = &errcallback;
+    oldcontext = MemoryContextSwitchTo(state.gamecontext);
+
+    while (p < end) {
+        switch (*p) {
+            case ' ': case '\t': case '\n': case '\r':
+                p++;
+                continue;
+            case '[':
+                if (state.started)
+                    _pgn_game_end(&state);
+                p = _pgn_tag(&state, p, end);
+                continue;
+            case '{':
+                while (p < end && *p != '}')
+                    p++;
+                p++;
+                continue;
+            case ';': case '%':
+                while (p < end && *p != '\n')
+                    p++;
+                continue;
+            case '(':
+                p = _pgn_skip_variation(p, end);
+                continue;
+            case ')': case '}':
+                // a stray close; the token below would be empty and never move p
+                p++;
+                continue;
+        }
+
+        for (t=p; t < end && !strchr(" \t\n\r{}();[", *t); t++)
+            ;
+        len = t - p;
+        if (len >= PGN_TOKEN_MAX)
+            BAD_TYPE_IN("pgn move", pnstrdup(p, len));
+        memcpy(token, p, len);
+        token[len] = '\0';
+        p = t;
+
+        if (token[0] == '$')
+            continue;
+        if (_pgn_result(token)) {
+            _pgn_game_start(&state);
+            _pgn_game_end(&state);
+            continue;
+        }
+        // move numbers, with or without the move after them
+        for (t=token; *t >= '0' && *t <= '9'; t++)
+            ;
+        if (t != token && *t == '.') {
+            while (*t == '.')
+                t++;
+        } else
+            t = token;
+        if (*t == '\0')
+            continue;
+
+        _pgn_game_start(&state);
+        m = _position_find_move(&state.pos, t);
+        _position_make(&state.pos, &m);
+        state.ply++;
+        _pgn_emit(&state, t);
+    }
+
+    MemoryContextSwitchTo(oldcontext);
+    error_context_stack = errcallback.previous;
+    MemoryContextDelete(state.gamecontext);
+    return (Datum) 0;
+}
+/*}}}*/
 /*
 const int *data = array.data(); // C array
 Datum *d = (Datum *) palloc(sizeof(Datum) * size);
@@ -0,0 +1,521 @@
+\set ON_ERROR_STOP on
+\o /dev/null
+
+CREATE TEMP TABLE boards(
+     fen            board           not null
+);
+INSERT INTO boards VALUES
+     ('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -')
+    ,('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR b KQkq -')
+    ,('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w Kkq -')
+    ,('rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3')
+    ,('rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq -')
+    ,('q2rn2k/p2p1p1P/1p1b4/2p5/2P5/3B4/PPn4P/R1B2bK1 w - -')
+    ,('q2rn2k/p2p1p1P/1p1b4/2p5/2P5/3B4/PPn4P/R1B2bK1 w - -');
+
+\echo 'zobrist'
+select expected_or_fail_bool(zobrist('8/8/8/8/8/8/8/K6k w - -') = zobrist('8/8/8/8/8/8/8/K6k w - -'), true);
+select expected_or_fail_bool(zobrist('8/8/8/8/8/8/8/K6k w - -') = zobrist('8/8/8/8/8/8/8/K6k b - -'), false);
+select expected_or_fail_bool(zobrist('8/8/8/8/8/8/8/K6k w - -') = zobrist('8/8/8/8/8/8/8/k6K w - -'), false);
+select expected_or_fail_int((select count(distinct zobrist(fen)) from boards)::int, 6);
+select expected_or_fail_bool(board_hash(fen) = zobrist(fen)::bit(32)::int, true) from boards;
+select expected_or_fail_bool(board_hash_extended(fen, 0) = zobrist(fen), true) from boards;
+
+\echo 'hash aggregate'
+set enable_sort = off;
+select expected_or_fail_int((select count(*) from (select fen from boards group by fen) as t)::int, 6);
+reset enable_sort;
+
+\echo 'sort'
+select expected_or_fail_int((select count(*) from boards a, boards b where (a.fen < b.fen)::int + (a.fen = b.fen)::int + (a.fen > b.fen)::int <> 1)::int, 0);
+select expected_or_fail_int((select count(*) from boards a, boards b where (a.fen < b.fen) <> (b.fen > a.fen))::int, 0);
+select expected_or_fail_bool('8/8/8/8/8/8/8/K6k w - -'::board = '8/8/8/8/8/8/8/K6k b - -'::board, false);
+select expected_or_fail_bool('8/8/8/8/8/8/8/K6k w - -'::board = '8/8/8/8/8/8/8/k6K w - -'::board, false);
+select expected_or_fail_bool('8/8/8/8/8/8/8/K6k w - -'::board < '8/8/8/8/8/8/8/K6k b - -'::board, false);
+select expected_or_fail_bool(array(select fen::text from boards order by fen) = array(select fen::text from boards order by fen desc) , false);
+
+\echo 'binary'
+select expected_or_fail_bool(encode(board_send('8/8/8/8/8/8/8/K6k w - -'), 'hex') = '0101ff00000000000000815b', true);
+select expected_or_fail_bool(encode(board_send('8/8/8/8/4P3/8/8/K6k b Kq e3'), 'hex') = '01121c000000000800008105b0', true);
+-- board_recv through a binary copy file: the enpassant pawn must have just moved
+create temp table recv_boards(fen board);
+do $$
+declare
+    path text := current_setting('data_directory') || '/chess_index_recv.bin';
+    t record;
+    o oid;
+begin
+    for t in select * from (values
+         ('01121c000000000800008105b0', true)      -- e4 pawn, black to move
+        ,('01123f000000000800008105b0', false)     -- off rank
+        ,('01131c000000000800008105b0', false)     -- white to move
+        ,('01121b000000000800008105b0', false)     -- no pawn on d4
+    ) as v(board, ok) loop
+        o := lo_from_bytea(0, decode('5047434f50590aff0d0a00' || '00000000' || '00000000'
+            || '0001' || lpad(to_hex(length(t.board) / 2), 8, '0') || t.board || 'ffff', 'hex'));
+        perform lo_export(o, path);
+        perform lo_unlink(o);
+        begin
+            execute format('copy recv_boards from %L with (format binary)', path);
+            if not t.ok then
+                raise exception 'bad enpassant was received: %', t.board;
+            end if;
+        exception when others then
+            if t.ok or sqlerrm not like '%board enpassant%' then
+                raise;
+            end if;
+        end;
+    end loop;
+end
+$$;
+select expected_or_fail_bool((select fen from recv_boards) = '8/8/8/8/4P3/8/8/K6k b Kq e3', true);
+drop table recv_boards;
+select expected_or_fail_bool(encode(square_send('h8'), 'hex') = '3f', true);
+select expected_or_fail_bool(encode(piecesquare_send('Nf5'), 'hex') = '0125', true);
+
+\echo 'storage'
+select expected_or_fail_int((select count(*) from boards where board_version(fen) <> 1)::int, 0);
+select expected_or_fail_int(pg_column_size('8/8/8/8/8/8/8/K6k w - -'::board), 17);
+select expected_or_fail_int((select max(pg_column_size(fen)) from boards), 29);
+select expected_or_fail_int((select count(*) from boards where board_upgrade(fen) <> fen)::int, 0);
+
+\echo 'gin'
+select expected_or_fail_int((select count(*) from boards where fen @> '{Ke1,ke8}'::piecesquare[])::int, 5);
+select expected_or_fail_int((select count(*) from boards where fen @> '{Pe4,pe7}'::piecesquare[])::int, 2);
+select expected_or_fail_int((select count(*) from boards where fen && '{Pe4,Kg1}'::piecesquare[])::int, 4);
+create index boards_gin on boards using gin(fen);
+set enable_seqscan = off;
+select expected_or_fail_int((select count(*) from boards where fen @> '{Ke1,ke8}'::piecesquare[])::int, 5);
+select expected_or_fail_int((select count(*) from boards where fen @> '{Pe4,pe7}'::piecesquare[])::int, 2);
+select expected_or_fail_int((select count(*) from boards where fen && '{Pe4,Kg1}'::piecesquare[])::int, 4);
+select expected_or_fail_int((select count(*) from boards where fen @> '{}'::piecesquare[])::int, 7);
+select expected_or_fail_int((select count(*) from boards where fen && '{}'::piecesquare[])::int, 0);
+reset enable_seqscan;
+drop index boards_gin;
+
+\echo 'gist'
+select expected_or_fail_int((select count(*) from boards where fen @> '8/8/8/8/4P3/8/8/8 w - -'::board)::int, 2);
+select expected_or_fail_int((select count(*) from boards where '7k/8/8/8/8/8/8/6K1 w - -'::board <@ fen)::int, 2);
+create index boards_gist on boards using gist(fen);
+set enable_seqscan = off;
+select expected_or_fail_int((select count(*) from boards where fen @> '8/8/8/8/4P3/8/8/8 w - -'::board)::int, 2);
+select expected_or_fail_int((select count(*) from boards where '7k/8/8/8/8/8/8/6K1 w - -'::board <@ fen)::int, 2);
+select expected_or_fail_int((select count(*) from boards where fen @> '8/8/8/8/8/8/8/8 w - -'::board)::int, 7);
+select expected_or_fail_int((select count(*) from boards where fen @> '8/8/8/8/4p3/8/8/8 w - -'::board)::int, 0);
+reset enable_seqscan;
+drop index boards_gist;
+
+\echo 'knn'
+select expected_or_fail_int(('8/8/8/8/8/8/8/K6k w - -'::board <-> '8/8/8/8/8/8/8/K6k w - -'::board)::int, 0);
+select expected_or_fail_int(('8/8/8/8/8/8/8/K6k w - -'::board <-> '8/8/8/8/8/8/8/1K5k b - -'::board)::int, 3);
+select expected_or_fail_int(('8/8/8/8/4P3/8/8/K6k b - e3'::board <-> '8/8/8/8/4P3/8/8/K6k b - -'::board)::int, 1);
+create index boards_gist on boards using gist(fen);
+set enable_seqscan = off;
+select expected_or_fail_bool((
+    select string_agg((fen <-> 'rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -')::text, ',')
+    from (select fen from boards order by fen <-> 'rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -' limit 5) t
+    ) = '0,1,1,3,4', true);
+reset enable_seqscan;
+drop index boards_gist;
+
+\echo 'moves'
+-- fen text round trips with the enpassant target square
+select expected_or_fail_bool('rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3'::board::text = 'rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3', true);
+select expected_or_fail_bool('rnbqkbnr/pppp1ppp/8/4p3/4P3/8/PPPP1PPP/RNBQKBNR w KQkq e6'::board::text = 'rnbqkbnr/pppp1ppp/8/4p3/4P3/8/PPPP1PPP/RNBQKBNR w KQkq e6', true);
+select expected_or_fail_int(legal_move_count('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -'), 20);
+select expected_or_fail_int(legal_move_count('r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -'), 48);
+select expected_or_fail_int(legal_move_count('8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - -'), 14);
+-- one call site fed repeated and changing boards
+select expected_or_fail_int((select sum(legal_move_count(b))::int from (values
+    ('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -'::board),
+    ('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -'),
+    ('8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - -'),
+    ('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -')) v(b)), 74);
+select expected_or_fail_int((select count(*) from moves('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -'))::int, 20);
+-- castling both ways
+select expected_or_fail_int((select count(*) from moves('r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -') m
+    where m.piece = 'K' and m.from = 'e1' and m.to in ('g1', 'c1'))::int, 2);
+-- d7xc8 promotes four ways
+select expected_or_fail_int((select count(*) from moves('rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ -')
+    where promotion is not null)::int, 4);
+-- enpassant is only kept when it can be taken
+select expected_or_fail_bool((select m.board from moves('rnbqkbnr/ppp1pppp/8/8/3p4/8/PPPPPPPP/RNBQKBNR w KQkq -') m
+    where m.from = 'e2' and m.to = 'e4') = 'rnbqkbnr/ppp1pppp/8/8/3pP3/8/PPPP1PPP/RNBQKBNR b KQkq e3', true);
+select expected_or_fail_bool((select m.board from moves('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -') m
+    where m.from = 'e2' and m.to = 'e4') = 'rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq -', true);
+select expected_or_fail_int((select count(*) from moves('rnbqkbnr/ppp1pppp/8/8/3pP3/8/PPPP1PPP/RNBQKBNR b KQkq e3') m
+    where m.from = 'd4' and m.to = 'e3')::int, 1);
+
+\echo 'apply'
+select expected_or_fail_bool(board_apply('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -', 'e4')
+    = board_apply('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -', 'e2e4'), true);
+select expected_or_fail_bool(board_apply('r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -', 'O-O')
+    = 'r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R4RK1 b kq -', true);
+select expected_or_fail_bool(board_apply('rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ -', 'dxc8=N+')
+    = 'rnNq1k1r/pp2bppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R b KQ -', true);
+select expected_or_fail_bool(board_apply('rnbqkbnr/ppp1pppp/8/8/3pP3/8/PPPP1PPP/RNBQKBNR b KQkq e3', 'd4e3')
+    = 'rnbqkbnr/ppp1pppp/8/8/8/4p3/PPPP1PPP/RNBQKBNR w KQkq -', true);
+select expected_or_fail_int((select count(*) from replay('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -',
+    '{e4,e5,Nf3,Nc6,Bb5,a6,Ba4,Nf6,O-O,Be7,Re1,b5,Bb3,d6,c3,O-O}'))::int, 17);
+select expected_or_fail_bool((select position from replay('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -',
+    '{e4,e5,Nf3,Nc6,Bb5,a6,Ba4,Nf6,O-O,Be7,Re1,b5,Bb3,d6,c3,O-O}') where ply = 16)
+    = 'r1bq1rk1/2p1bppp/p1np1n2/1p2p3/4P3/1BP2N2/PP1P1PPP/RNBQR1K1 w - -', true);
+select expected_or_fail_bool(board_apply(board_apply(board_apply(board_expand('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -'),
+    'e4'), 'c5'), 'e5') = 'rnbqkbnr/pp1ppppp/8/2p1P3/8/8/PPPP1PPP/RNBQKBNR b KQkq -', true);
+select expected_or_fail_bool(zobrist(board_apply(board_expand('rnbqkbnr/pp1ppppp/8/2p1P3/8/8/PPPP1PPP/RNBQKBNR b KQkq -'), 'd5'))
+    = zobrist('rnbqkbnr/pp2pppp/8/2ppP3/8/8/PPPP1PPP/RNBQKBNR w KQkq d6'), true);
+do $$
+declare
+    b board := board_expand('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -');
+    m text;
+begin
+    foreach m in array '{e4,e5,Nf3,Nc6,Bb5,a6}'::text[] loop
+        b := board_apply(b, m);
+    end loop;
+    if b != 'r1bqkbnr/1ppp1ppp/p1n5/1B2p3/4P3/5N2/PPPP1PPP/RNBQK2R w KQkq -' then
+        raise exception 'expanded board: %', b;
+    end if;
+end
+$$;
+
+\echo 'pgn'
+create temp table pgn as select * from pgn_positions($pgn$
+[Event "one"]
+[Result "1-0"]
+1. e4 e5 2. Nf3 {a comment (with parens)} Nc6 3. Bb5 a6 (3... Nf6 4. O-O (4. d3) Nxe4) 4. Ba4 $1 Nf6
+5. O-O Be7 ; the rest of the line is a comment
+6. Re1 b5 7. Bb3 d6 8. c3 O-O 1-0
+[Event "two"]
+[SetUp "1"]
+[FEN "8/8/8/8/8/5k2/8/R3K3 w Q - 0 1"]
+1. O-O-O Ke3 2.Rd3+ Ke4 *
+[Event "three"]
+1.d4 d5
+$pgn$);
+select expected_or_fail_int((select count(*) from pgn)::int, 25);
+select expected_or_fail_int((select count(distinct game_no) from pgn)::int, 3);
+select expected_or_fail_bool((select position from pgn where game_no = 1 and ply = 16)
+    = 'r1bq1rk1/2p1bppp/p1np1n2/1p2p3/4P3/1BP2N2/PP1P1PPP/RNBQR1K1 w - -', true);
+select expected_or_fail_bool((select position from pgn where game_no = 2 and ply = 0)
+    = '8/8/8/8/8/5k2/8/R3K3 w Q -', true);
+select expected_or_fail_bool((select move from pgn where game_no = 2 and ply = 3) = 'Rd3+', true);
+select expected_or_fail_bool((select move is null from pgn where game_no = 3 and ply = 0), true);
+do $$
+begin
+    perform pgn_positions('[FEN "' || repeat('8/', 60) || ' w - - 0 1"] 1. e4 *');
+    raise exception 'overlong FEN tag was accepted';
+exception when others then
+    if sqlerrm not like '%FEN tag is longer%' then
+        raise;
+    end if;
+end
+$$;
+-- a stray close is skipped, and a truncated tag ends the text
+select expected_or_fail_int((select count(*) from pgn_positions('1. e4 ) e5 } 2. Nf3 *'))::int, 4);
+select expected_or_fail_int((select count(*) from pgn_positions('1. e4 e5 [FE'))::int, 3);
+
+\echo 'attacks'
+select expected_or_fail_bool(attacks('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -', 'w') = x'ffff7e'::int8, true);
+select expected_or_fail_bool(attacks('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -', 'b') = x'7effff0000000000'::int8, true);
+-- e2 is covered by the king, queen, bishop and knight
+select expected_or_fail_int(bit_count((attackers('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -', 'e2', 'w'))::bit(64))::int, 4);
+select expected_or_fail_bool(in_check('4k3/4r3/8/8/8/8/8/4K3 w - -'), true);
+select expected_or_fail_bool(in_check('4k3/3r4/8/8/8/8/8/4K3 w - -'), false);
+-- the knight is pinned on the file and the bishop on the rank
+select expected_or_fail_bool(pinned('4k3/4r3/8/8/4N3/8/2b5/r2BK3 w - -', 'w')
+    = (1::int8 << 'd1'::square::int) | (1::int8 << 'e4'::square::int), true);
+select expected_or_fail_bool(pinned('4k3/4r3/8/8/4N3/8/2b5/r2BK3 w - -', 'b') = 0, true);
+select expected_or_fail_bool(hanging('4k3/8/8/3n4/8/2N5/8/4K3 w - -', 'b') = 1::int8 << 'd5'::square::int, true);
+select expected_or_fail_bool(hanging('4k3/8/4p3/3n4/8/2N5/8/4K3 w - -', 'b') = 0, true);
+
+\echo 'material'
+select expected_or_fail_bool(material('8/8/4k3/4r3/8/4K3/4PR2/8 w - -') = 'KRPkr', true);
+select expected_or_fail_bool('rPkKr'::material = 'KRPkr', true);
+select expected_or_fail_bool(material('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -')::text = 'KQRRBBNNPPPPPPPPkqrrbbnnpppppppp', true);
+select expected_or_fail_bool(material('QQQ1k3/8/8/8/8/8/8/4K3 w - -')::text = 'KQQQk', true);
+select expected_or_fail_bool(pieces('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -', 'w') = 'QRRBBNNPPPPPPPP', true);
+select expected_or_fail_bool(pieces('8/8/4k3/4r3/8/4K3/4PR2/8 w - -', 'w') = '.R.....P.......', true);
+select expected_or_fail_bool(pieces('QQQ1k3/8/8/8/8/8/8/4K3 w - -', 'w') = 'Q..............', true);
+select expected_or_fail_bool('KRPkr'::material @> 'KRkr', true);
+select expected_or_fail_bool('KRPkr'::material @> 'KQk', false);
+select expected_or_fail_bool('Kk'::material <@ 'KRPkr', true);
+select expected_or_fail_int(imbalance('KRPkr'), 1);
+select expected_or_fail_int(imbalance('KQkrr'), -1);
+select expected_or_fail_bool('KRPkr'::material #>= 1, true);
+select expected_or_fail_bool('KRPkr'::material #>= 2, false);
+select expected_or_fail_bool('KQkrr'::material #<= -1, true);
+select expected_or_fail_bool('KQkrr'::material #<= -2, false);
+select expected_or_fail_int((select count(*) from boards where material(fen) #>= 0)::int,
+    (select count(*) from boards where imbalance(material(fen)) >= 0)::int);
+select expected_or_fail_int((select count(distinct material(fen)) from boards)::int, 2);
+set enable_sort = off;
+select expected_or_fail_int((select count(*) from (select material(fen) from boards group by 1) as t)::int, 2);
+reset enable_sort;
+
+\echo 'pawnkey'
+select expected_or_fail_bool(pawns('q2rn2k/p2p1p1P/1p1b4/2p5/2P5/3B4/PPn4P/R1B2bK1 w - -')::text = '8/p2p1p1P/1p6/2p5/2P5/8/PP5P/8', true);
+select expected_or_fail_bool(encode(pawnkey_send('8/8/8/8/4P3/8/8/8'), 'hex') = '00000000100000000000000000000000', true);
+select expected_or_fail_int((select count(distinct pawns(fen)) from boards)::int, 3);
+set enable_sort = off;
+select expected_or_fail_int((select count(*) from (select pawns(fen) from boards group by 1) as t)::int, 3);
+reset enable_sort;
+select expected_or_fail_int((select count(*) from boards where pawns(fen) = '8/pppppppp/8/8/8/8/PPPPPPPP/8')::int, 3);
+select expected_or_fail_int((select count(*) from boards where pawns(fen) @> '8/8/8/8/4P3/8/8/8')::int, 2);
+select expected_or_fail_int((select count(*) from boards where pawns(fen) <@ '8/pppppppp/8/8/4P3/8/PPPPPPPP/8')::int, 5);
+create index boards_pawns on boards using gin(pawns(fen));
+set enable_seqscan = off;
+select expected_or_fail_int((select count(*) from boards where pawns(fen) = '8/pppppppp/8/8/8/8/PPPPPPPP/8')::int, 3);
+select expected_or_fail_int((select count(*) from boards where pawns(fen) @> '8/8/8/8/4P3/8/8/8')::int, 2);
+select expected_or_fail_int((select count(*) from boards where pawns(fen) <@ '8/pppppppp/8/8/4P3/8/PPPPPPPP/8')::int, 5);
+select expected_or_fail_int((select count(*) from boards where pawns(fen) @> '8/8/8/8/8/8/8/8')::int, 7);
+select expected_or_fail_int((select count(*) from boards where pawns(fen) <@ '8/8/8/8/8/8/8/8')::int, 0);
+reset enable_seqscan;
+drop index boards_pawns;
+
+\echo 'bloom'
+select expected_or_fail_bool(castling('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w Kkq -') = 'Kkq', true);
+select expected_or_fail_bool(castling('8/8/8/8/8/8/8/K6k w - -') = '-', true);
+select expected_or_fail_bool(piece_at('rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq -', 'e4') = 'P', true);
+select expected_or_fail_bool(piece_at('rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq -', 'e2') is null, true);
+-- the index part needs contrib bloom
+do $$
+begin
+    if exists (select 1 from pg_available_extensions where name = 'bloom') then
+        create extension if not exists bloom;
+        perform create_bloom_opclasses();
+        perform expected_or_fail_bool(exists(select 1 from pg_depend d join pg_opclass c on c.oid = d.objid
+            where d.classid = 'pg_opclass'::regclass and d.deptype = 'e' and c.opcname = 'bloom_board_ops'), true);
+        create index boards_bloom on boards using bloom (side(fen), castling(fen), material(fen), piece_at(fen, 'e4'));
+        set local enable_seqscan = off;
+        set local enable_bitmapscan = on;
+        perform expected_or_fail_int((select count(*) from boards where side(fen) = 'b' and piece_at(fen, 'e4') = 'P')::int, 2);
+        perform expected_or_fail_int((select count(*) from boards where castling(fen) = 'Kkq')::int, 1);
+        perform expected_or_fail_int((select count(*) from boards
+            where material(fen) = 'KQRRBBNNPPPPPPPPkqrrbbnnpppppppp' and side(fen) = 'w')::int, 2);
+        drop index boards_bloom;
+    end if;
+end
+$$;
+
+\echo 'brin'
+select expected_or_fail_int((select count(*) from boards where fen #<= 21)::int, 2);
+select expected_or_fail_int((select count(*) from boards where fen #>= 32)::int, 5);
+select expected_or_fail_int((select count(*) from boards where fen = 'KQRRBBNNPPPPPPPPkqrrbbnnpppppppp'::material)::int, 5);
+create index boards_brin on boards using brin(fen) with (pages_per_range = 1);
+set enable_seqscan = off;
+select expected_or_fail_int((select count(*) from boards where fen #<= 21)::int, 2);
+select expected_or_fail_int((select count(*) from boards where fen #<= 20)::int, 0);
+select expected_or_fail_int((select count(*) from boards where fen #>= 32)::int, 5);
+select expected_or_fail_int((select count(*) from boards where fen = 'KQRRBBNNPPPPPPPPkqrrbbnnpppppppp'::material)::int, 5);
+select expected_or_fail_int((select count(*) from boards where fen @> '{Ph7}'::piecesquare[])::int, 2);
+select expected_or_fail_int((select count(*) from boards where fen && '{Ph7,Pe4}'::piecesquare[])::int, 4);
+select expected_or_fail_int((select count(*) from boards where fen @> '8/8/8/8/4P3/8/8/8 w - -'::board)::int, 2);
+reset enable_seqscan;
+drop index boards_brin;
+
+\echo 'heatmap'
+-- white pawn on e2 and e4, black king on e8
+select expected_or_fail_int((select (heatmap(fen))[1][13] from boards)::int, 3);
+select expected_or_fail_int((select (heatmap(fen))[1][29] from boards)::int, 2);
+select expected_or_fail_int((select (heatmap(fen))[12][61] from boards)::int, 5);
+select expected_or_fail_bool((select heatmap(fen) from boards where false) is null, true);
+select expected_or_fail_int((select sum(x) from unnest((select heatmap(fen) from boards)) x)::int,
+    (select sum(pcount(fen)) from boards)::int);
+-- two row window: the inverse transition takes back the row that left
+select expected_or_fail_int((select count(*) from (
+    select heatmap(fen) over w as h, pcount(fen) + coalesce(lag(pcount(fen)) over w, 0) as n
+    from boards window w as (order by fen rows between 1 preceding and current row)) t
+    where (select sum(x) from unnest(h) x) <> n)::int, 0);
+create table heatmap_boards as select fen from boards, generate_series(1, 2000);
+set parallel_setup_cost = 0;
+set parallel_tuple_cost = 0;
+set min_parallel_table_scan_size = 0;
+set max_parallel_workers_per_gather = 2;
+select expected_or_fail_int((select (heatmap(fen))[1][13] from heatmap_boards)::int, 6000);
+reset parallel_setup_cost;
+reset parallel_tuple_cost;
+reset min_parallel_table_scan_size;
+reset max_parallel_workers_per_gather;
+drop table heatmap_boards;
+
+\echo 'boards_from_text'
+select expected_or_fail_bool(boards_from_text((select array_agg(fen::text order by fen) from boards))
+    = (select array_agg(fen order by fen) from boards), true);
+select expected_or_fail_bool(boards_from_text('{"8/8/8/8/8/8/8/8 w - -",NULL}')
+    = array['8/8/8/8/8/8/8/8 w - -'::board, null], true);
+-- the move clocks are ignored
+select expected_or_fail_bool((boards_from_text('{"rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1"}'))[1]
+    = 'rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3', true);
+select expected_or_fail_int(array_ndims(boards_from_text('{{"8/8/8/8/8/8/8/8 w - -"},{"8/8/8/8/8/8/8/8 b - -"}}')), 2);
+select expected_or_fail_int(cardinality(boards_from_text('{}')), 0);
+do $$
+begin
+    perform boards_from_text('{"8/8/8/8/8/8/8/8 w - -","8/8/8/8/8/8/8/7 w - -"}');
+    raise exception 'short board was accepted';
+exception when others then
+    if sqlerrm not like '%too short%' then
+        raise;
+    end if;
+end
+$$;
+-- truncated fens, as cstring and as text
+do $$
+declare
+    t record;
+begin
+    for t in select * from (values
+         ('8/8/8/8/8/8/8/K6k', 'missing side field')
+        ,('8/8/8/8/8/8/8/K6k w', 'missing castling field')
+        ,('8/8/8/8/8/8/8/K6k w ', 'missing castling field')
+        ,('8/8/8/8/8/8/8/K6k w -', 'missing enpassant field')
+        ,('8/8/8/8/8/8/8/K6k w - ', 'missing enpassant field')
+    ) as v(fen, msg) loop
+        begin
+            perform t.fen::board;
+            raise exception 'truncated fen was accepted: %', t.fen;
+        exception when others then
+            if sqlerrm not like '%' || t.msg || '%' then
+                raise;
+            end if;
+        end;
+        begin
+            perform boards_from_text(array[t.fen]);
+            raise exception 'truncated fen text was accepted: %', t.fen;
+        exception when others then
+            if sqlerrm not like '%' || t.msg || '%' then
+                raise;
+            end if;
+        end;
+    end loop;
+end
+$$;
+
+\echo 'export_fen'
+select current_setting('data_directory') || '/chess_index_export.fen' as export_path \gset
+select expected_or_fail_int(export_fen('select fen from boards order by fen', :'export_path')::int, 7);
+select expected_or_fail_bool(pg_read_file(:'export_path')
+    = (select string_agg(fen::text || ' 0 1' || E'\n', '' order by fen) from boards), true);
+select expected_or_fail_int(export_fen('select fen from boards union all select null', :'export_path', true)::int, 7);
+select expected_or_fail_bool((select array_agg(l::board order by l::board)
+    from regexp_split_to_table(rtrim(pg_read_file(:'export_path'), E'\n'), E'\n') l)
+    = (select array_agg(fen order by fen) from boards), true);
+-- plpgsql does not see psql variables
+do $$
+begin
+    perform export_fen('select 1', current_setting('data_directory') || '/chess_index_export.fen');
+    raise exception 'export of a non board column was accepted';
+exception when others then
+    if sqlerrm not like '%must be a board%' then
+        raise;
+    end if;
+end
+$$;
+do $$
+begin
+    perform export_fen('select fen from boards', 'chess_index_export.fen');
+    raise exception 'relative export path was accepted';
+exception when others then
+    if sqlerrm not like '%relative path not allowed%' then
+        raise;
+    end if;
+end
+$$;
+select expected_or_fail_int(export_fen('select fen from boards where false', :'export_path')::int, 0);
+
+\echo 'stats'
+select chess_index_stats_reset();
+select fen::text from boards;
+create temp table stats as select * from chess_index_stats();
+select expected_or_fail_int((select calls from stats where function = 'board_out')::int, 7);
+-- fen and its terminating null
+select expected_or_fail_bool((select bytes from stats where function = 'board_out')
+    = (select sum(length(fen::text) + 1) from boards), true);
+drop table stats;
+select expected_or_fail_int((select calls from chess_index_stats() where function = 'board_in')::int, 0);
+select expected_or_fail_int(cardinality(boards_from_text('{"8/8/8/8/8/8/8/8 w - -","8/8/8/8/8/8/8/8 b - -"}')), 2);
+select expected_or_fail_int((select calls from chess_index_stats() where function = 'board_in')::int, 2);
+select fen from boards order by fen;
+select expected_or_fail_bool((select calls from chess_index_stats() where function = 'board_cmp') > 0, true);
+set chess_index.track_stats = off;
+select chess_index_stats_reset();
+select fen::text from boards;
+select expected_or_fail_int((select sum(calls) from chess_index_stats())::int, 0);
+reset chess_index.track_stats;
+
+\echo 'symmetry'
+select expected_or_fail_bool(flip_colors('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -')
+    = 'rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR b KQkq -', true);
+select expected_or_fail_bool(flip_colors('rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3')
+    = 'rnbqkbnr/pppp1ppp/8/4p3/8/8/PPPPPPPP/RNBQKBNR w KQkq e6', true);
+select expected_or_fail_bool(flip_colors('r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w Kq -')
+    = 'r3k2r/pppbbppp/2n2q1P/1P2p3/3pn3/BN2PNP1/P1PPQPB1/R3K2R b Qk -', true);
+select expected_or_fail_int((select count(*) from boards where flip_colors(flip_colors(fen)) <> fen)::int, 0);
+select expected_or_fail_bool(mirror_files('4k3/8/8/3pP3/8/8/8/4K3 w - d6') = '3k4/8/8/3Pp3/8/8/8/3K4 w - e6', true);
+select expected_or_fail_bool(mirror_files('8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - -') = '8/5p2/4p3/r5PK/k1p3R1/8/1P1P4/8 w - -', true);
+select expected_or_fail_int((select count(*) from boards where mirror_files(mirror_files(fen)) <> fen and castling(fen) = '-')::int, 0);
+-- the color reversed position has the same tree
+select expected_or_fail_int(perft(flip_colors('r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -'), 2)::int, 2039);
+select expected_or_fail_int((select count(*) from boards where canonical(fen) <> canonical(flip_colors(fen)))::int, 0);
+select expected_or_fail_int((select count(*) from boards where side(canonical(fen)) <> 'w')::int, 0);
+create index boards_canonical on boards (canonical(fen));
+set enable_seqscan = off;
+select expected_or_fail_int((select count(*) from boards
+    where canonical(fen) = canonical('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR b KQkq -'))::int, 2);
+reset enable_seqscan;
+drop index boards_canonical;
+
+\echo 'selectivity'
+create temp table skewed as
+    select case when i % 10 = 0 then '4k3/8/8/3pP3/8/8/8/4K3 w - -'::board
+                else 'rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -'::board end as fen
+    from generate_series(1, 1000) as i;
+analyze skewed;
+create function pg_temp.estimate(query text) returns int language plpgsql as $$
+declare
+    plan json;
+begin
+    execute 'explain (format json) ' || query into plan;
+    return (plan->0->'Plan'->>'Plan Rows')::int;
+end
+$$;
+select expected_or_fail_int(pg_temp.estimate($q$select * from skewed where fen @> '{Pe2}'$q$), 900);
+select expected_or_fail_int(pg_temp.estimate($q$select * from skewed where fen && '{Pe5,Qd1}'$q$), 1000);
+select expected_or_fail_int(pg_temp.estimate($q$select * from skewed where fen @> '8/8/8/3pP3/8/8/8/8 w - -'$q$), 100);
+select expected_or_fail_int(pg_temp.estimate($q$select * from skewed where '8/8/8/3pP3/8/8/8/8 w - -' <@ fen$q$), 100);
+select expected_or_fail_int(pg_temp.estimate($q$select * from skewed where fen #<= 4$q$), 100);
+select expected_or_fail_int(pg_temp.estimate($q$select * from skewed where fen = 'KPkp'::material$q$), 100);
+-- nothing sampled has it: below one row's worth of the sample, above zero
+select expected_or_fail_bool(pg_temp.estimate($q$select * from skewed where fen @> '{Qe4}'$q$) between 1 and 10, true);
+select expected_or_fail_int(pg_temp.estimate($q$select * from skewed a join skewed b on a.fen @> b.fen$q$), 820000);
+select expected_or_fail_int((select count(*) from pg_statistic where starelid = 'skewed'::regclass
+    and 12100 in (stakind1, stakind2, stakind3, stakind4, stakind5)
+    and 12101 in (stakind1, stakind2, stakind3, stakind4, stakind5))::int, 1);
+-- one most common board and no histogram: pcount and material come from typanalyze
+alter table skewed alter fen set statistics 1;
+analyze skewed;
+select expected_or_fail_int(pg_temp.estimate($q$select * from skewed where fen #<= 4$q$), 100);
+select expected_or_fail_int(pg_temp.estimate($q$select * from skewed where fen #>= 4$q$), 1000);
+select expected_or_fail_int(pg_temp.estimate($q$select * from skewed where fen = 'KPkp'::material$q$), 100);
+drop table skewed;
+
+\echo 'position interning'
+select expected_or_fail_bool(position_id('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -')
+    = position_id('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -'), true);
+select expected_or_fail_bool(position_id('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -')
+    = position_id('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR b KQkq -'), false);
+select expected_or_fail_int((select count(distinct position_id(fen)) - count(distinct fen) from boards)::int, 0);
+select expected_or_fail_int((select count(*) from boards where position_of(position_id(fen)) <> fen)::int, 0);
+select expected_or_fail_int((select count(*) from chess_index_positions)::int, (select count(distinct fen) from boards)::int);
+select expected_or_fail_bool(position_of(-1) is null, true);
+-- ids of a rolled back insert are not kept
+begin;
+select position_id('8/8/8/8/8/8/8/K6k w - -') > 0;
+rollback;
+select expected_or_fail_bool(position_of(position_id('8/8/8/8/8/8/8/K6k w - -')) = '8/8/8/8/8/8/8/K6k w - -', true);
+-- the cached plans follow the extension to another schema
+create schema chess_moved;
+alter extension chess_index set schema chess_moved;
+select expected_or_fail_bool(chess_moved.position_of(chess_moved.position_id('8/8/8/8/8/8/8/K6k w - -'))::text
+    = '8/8/8/8/8/8/8/K6k w - -', true);
+alter extension chess_index set schema public;
+drop schema chess_moved;
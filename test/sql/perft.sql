@@ -0,0 +1,43 @@
+\set ON_ERROR_STOP on
+\o /dev/null
+
+-- the standard perft positions: https://www.chessprogramming.org/Perft_Results
+CREATE TEMP TABLE perft_position(
+     name           text            not null
+    ,fen            board           not null
+    ,depth          int             not null
+    ,nodes          int8            not null
+);
+INSERT INTO perft_position VALUES
+     ('initial',  'rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -', 1, 20)
+    ,('initial',  'rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -', 2, 400)
+    ,('initial',  'rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -', 3, 8902)
+    ,('initial',  'rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -', 4, 197281)
+    ,('kiwipete', 'r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -', 1, 48)
+    ,('kiwipete', 'r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -', 2, 2039)
+    ,('kiwipete', 'r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -', 3, 97862)
+    ,('position3', '8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - -', 1, 14)
+    ,('position3', '8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - -', 2, 191)
+    ,('position3', '8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - -', 3, 2812)
+    ,('position3', '8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - -', 4, 43238)
+    ,('position4', 'r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq -', 1, 6)
+    ,('position4', 'r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq -', 2, 264)
+    ,('position4', 'r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq -', 3, 9467)
+    ,('position5', 'rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ -', 1, 44)
+    ,('position5', 'rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ -', 2, 1486)
+    ,('position5', 'rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ -', 3, 62379)
+    ,('position6', 'r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - -', 1, 46)
+    ,('position6', 'r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - -', 2, 2079)
+    ,('position6', 'r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - -', 3, 89890)
+;
+
+\echo 'perft'
+select expected_or_fail_int((select count(*) from perft_position where perft(fen, depth) <> nodes)::int, 0);
+select expected_or_fail_int(perft('rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -', 0)::int, 1);
+select expected_or_fail_int((select count(*) from perft_position where legal_move_count(fen) <> nodes and depth = 1)::int, 0);
+
+\echo 'divide'
+select expected_or_fail_int((select count(*) from perft_position p
+    where (select sum(nodes) from perft_divide(p.fen, p.depth)) <> p.nodes)::int, 0);
+select expected_or_fail_int((select nodes from perft_divide('rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ -', 2)
+    where move = 'd7c8n')::int, 41);